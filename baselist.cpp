@@ -1,37 +1,167 @@
 #include <iostream>
+#include <memory>
+#include <type_traits>
+#include <utility>
 #include "node.cpp"
+#include "nodepool.cpp"
 
-template <typename T>
+/**
+ * @tparam T
+ * @tparam Allocator Allocator all nodes, including the sentinels, are taken from
+ */
+template <typename T, typename Allocator = std::allocator<T>>
 class BaseList {
 public:
-    int size = 0;
+    NodePool<Node<T>, Allocator> nodes;
+    int64_t size = 0;
 
-    Node<T>* head = new Node<T>;
-    Node<T>* tail = new Node<T>;
+    Node<T>* head = nodes.allocateSentinel();
+    Node<T>* tail = nodes.allocateSentinel();
 
     BaseList() {
+        linkSentinels();
+    }
+
+    explicit BaseList(const Allocator& allocator) : nodes(allocator) {
+        linkSentinels();
+    }
+
+    /**
+     * Copies all nodes of the other list in one pass
+     * @param other
+     */
+    BaseList(const BaseList& other) :
+    nodes(std::allocator_traits<Allocator>::select_on_container_copy_construction(other.getAllocator())) {
+        linkSentinels();
+        copyNodes(other);
+    }
+
+    /**
+     * Takes over the sentinels and with them all nodes of the other list in O(1).
+     * The other list receives new sentinels and is empty afterwards.
+     * @param other
+     */
+    BaseList(BaseList&& other) : nodes(std::move(other.nodes)), size(other.size), head(other.head), tail(other.tail) {
+        other.size = 0;
+        other.head = other.nodes.allocateSentinel();
+        other.tail = other.nodes.allocateSentinel();
+        other.linkSentinels();
+    }
+
+    BaseList& operator=(const BaseList& other) {
+        if (this != &other) {
+            clear();
+            copyNodes(other);
+        }
+        return *this;
+    }
+
+    /**
+     * Frees the own nodes and swaps sentinels with the other list, leaving it empty. Nodes are copied
+     * instead if the allocators differ and do not propagate, as they cannot free each other's nodes.
+     * @param other
+     * @return This list
+     */
+    BaseList& operator=(BaseList&& other) {
+        if (this == &other)
+            return *this;
+
+        if constexpr (!std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value) {
+            if (getAllocator() != other.getAllocator()) {
+                *this = other;
+                other.clear();
+                return *this;
+            }
+        }
+        clear();
+        std::swap(head, other.head);
+        std::swap(tail, other.tail);
+        std::swap(size, other.size);
+        nodes.swap(other.nodes);
+        return *this;
+    }
+
+    /**
+     * Frees all blocks at once. For trivially destructible elements the nodes are not visited at all,
+     * which makes tearing down a list that lives in a monotonic arena a no-op.
+     */
+    virtual ~BaseList() {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+            destroyNodes();
+        nodes.releaseSentinel(head);
+        nodes.releaseSentinel(tail);
+    }
+
+    Allocator getAllocator() const {
+        return nodes.getAllocator();
+    }
+
+    void linkSentinels() {
         head->setNextNode(tail);
+        head->setPrevNode(nullptr);
         tail->setPrevNode(head);
+        tail->setNextNode(nullptr);
         head->setData({});
         tail->setData({});
     }
 
-    ~BaseList() {
-        Node<T>* node;
-        while (hasNext(getFirstNode())) {
-            node = getFirstNode();
-            node->unlink();
-            delete node;
+    Node<T>* newNode() {
+        return nodes.allocate();
+    }
+
+    void deleteNode(Node<T>* node) {
+        nodes.release(node);
+    }
+
+    /**
+     * Destroys all nodes without unlinking them, their blocks are freed by resetting the pool afterwards
+     */
+    void destroyNodes() {
+        Node<T>* node = getFirstNode();
+        while (node != tail) {
+            Node<T>* next = node->getNextNode();
+            nodes.destroy(node);
+            node = next;
         }
-        delete head;
-        delete tail;
     }
 
-    int getSize() {
+    /**
+     * Appends copies of all nodes of the other list without going through incSize
+     * @param other
+     */
+    void copyNodes(const BaseList& other) {
+        Node<T>* node = other.head->getNextNode();
+        while (node != other.tail) {
+            auto* copy = newNode();
+            copy->setData(node->getData());
+            copy->setPrevNode(getLastNode());
+            copy->setNextNode(getTail());
+            copy->setNextOfPrev(copy);
+            getTail()->setPrevNode(copy);
+            size++;
+            node = node->getNextNode();
+        }
+    }
+
+    int64_t getSize() {
         return size;
     }
 
-    int getMaxIndex() {
+    /**
+     * @return Bytes of the nodes in use, including both sentinels and the block bookkeeping of the pool
+     */
+    size_t nodeBytes() const {
+        return nodes.usedBytes() + 2 * sizeof(typename NodePool<Node<T>, Allocator>::Slot);
+    }
+
+    /**
+     * @return Bytes of the pooled slots that no node is using
+     */
+    size_t freeNodeBytes() const {
+        return nodes.freeBytes();
+    }
+
+    int64_t getMaxIndex() {
         return getSize() - 1;
     }
 
@@ -39,7 +169,7 @@ public:
         return getSize() == 0;
     }
 
-    virtual bool useForwardSearch(int index) {
+    virtual bool useForwardSearch(int64_t index) {
         return getSize() - index > getSize() / 2;
     }
 
@@ -83,11 +213,11 @@ public:
         getLastNode()->setData(data);
     }
 
-    virtual void set(int index, T data) {
+    virtual void set(int64_t index, T data) {
         getNode(index)->setData(data);
     }
 
-    virtual T get(int index) {
+    virtual T get(int64_t index) {
         return getNode(index)->getData();
     }
 
@@ -107,13 +237,51 @@ public:
         size--;
     }
 
-    void clear() {
-        while (hasNext(getFirstNode()))
-            removeFirst();
+    /**
+     * Deletes all nodes in one pass without going through removeFirst
+     */
+    virtual void clear() {
+        if constexpr (!std::is_trivially_destructible_v<T>)
+            destroyNodes();
+        nodes.reset();
+        head->setNextNode(tail);
+        tail->setPrevNode(head);
+        size = 0;
     }
 
-    virtual void prepend(T data) {
-        auto* node = new Node<T>;
+    /**
+     * Moves all elements into one fresh block of nodes in list order, so that walking the list reads
+     * memory sequentially again, and frees the old, fragmented blocks. Node handles and slices of this
+     * list become invalid.
+     */
+    virtual void compact() {
+        NodePool<Node<T>, Allocator> compacted(nodes.allocator);
+        compacted.reserve(size);
+
+        Node<T>* prev = head;
+        Node<T>* node = getFirstNode();
+        while (node != tail) {
+            Node<T>* copy = compacted.allocate();
+            copy->data = std::move(node->data);
+            copy->setPrevNode(prev);
+            prev->setNextNode(copy);
+            prev = copy;
+
+            Node<T>* next = node->getNextNode();
+            nodes.destroy(node);
+            node = next;
+        }
+        prev->setNextNode(tail);
+        tail->setPrevNode(prev);
+        nodes.swap(compacted);
+    }
+
+    /**
+     * @param data
+     * @return The new node
+     */
+    virtual Node<T>* prepend(T data) {
+        auto* node = newNode();
         node->setData(data);
 
         node->setPrevNode(getHead());
@@ -123,10 +291,15 @@ public:
         node->getNextNode()->setPrevNode(node);
 
         incSize();
+        return node;
     }
 
-    void append(T data) {
-        auto* node = new Node<T>;
+    /**
+     * @param data
+     * @return The new node
+     */
+    virtual Node<T>* append(T data) {
+        auto* node = newNode();
         node->setData(data);
 
         node->setPrevNode(getLastNode());
@@ -136,20 +309,31 @@ public:
         getTail()->setPrevNode(node);
 
         incSize();
+        return node;
     }
 
     void linkUpNode(Node<T>* node, Node<T>* nextNode, T data) {
+        linkNode(node, nextNode, data);
+        incSize();
+    }
+
+    /**
+     * Links the node in front of nextNode without changing the size
+     * @param node
+     * @param nextNode
+     * @param data
+     */
+    void linkNode(Node<T>* node, Node<T>* nextNode, T data) {
         node->setData(data);
         node->setNextNode(nextNode);
         node->setPrevNode(nextNode->getPrevNode());
         node->setPrevOfNext(node);
         node->setNextOfPrev(node);
-        incSize();
     }
 
-    Node<T>* searchFromFront(int index) {
+    Node<T>* searchFromFront(int64_t index) {
         Node<T>* node = getFirstNode();
-        int i = 0;
+        int64_t i = 0;
 
         while (this->hasNext(node)) {
             if (i == index)
@@ -160,9 +344,9 @@ public:
         return getLastNode();
     }
 
-    Node<T>* searchFromBack(int index) {
+    Node<T>* searchFromBack(int64_t index) {
         Node<T>* node = getLastNode();
-        int i = getMaxIndex();
+        int64_t i = getMaxIndex();
 
         while (hasPrev(node)) {
             if (i == index)
@@ -173,33 +357,33 @@ public:
         return getFirstNode();
     }
 
-    void addFromFront(int index, T data) {
-        linkUpNode(new Node<T>, searchFromFront(index), data);
+    void addFromFront(int64_t index, T data) {
+        linkUpNode(newNode(), searchFromFront(index), data);
     }
 
-    void addFromBack(int index, T data) {
-        linkUpNode(new Node<T>, searchFromBack(index), data);
+    void addFromBack(int64_t index, T data) {
+        linkUpNode(newNode(), searchFromBack(index), data);
     }
 
-    void removeFirst() {
+    virtual void removeFirst() {
         if (isEmpty())
             return;
         removeNode(getFirstNode());
     }
 
-    virtual void remove(int index) {
+    virtual void remove(int64_t index) {
         if (isEmpty())
             return;
         removeNode(getNode(index));
     }
 
-    void removeLast() {
+    virtual void removeLast() {
         if (isEmpty())
             return;
         removeNode(getLastNode());
     }
 
-    Node<T>* getNode(int index) {
+    Node<T>* getNode(int64_t index) {
         if (isEmpty())
             return getHead();
 
@@ -211,25 +395,25 @@ public:
         Node<T>* node;
         if (useForwardSearch(index)) {
             node = getFirstNode();
-            for (int i = 0; hasNext(node) && i < index; i++)
+            for (int64_t i = 0; hasNext(node) && i < index; i++)
                 node = node->getNextNode();
         } else {
             node = getLastNode();
-            for (int i = getMaxIndex(); hasPrev(node) && i > index; i--)
+            for (int64_t i = getMaxIndex(); hasPrev(node) && i > index; i--)
                 node = node->getPrevNode();
         }
         return node;
     }
 
-    void removeNode(Node<T>* node) {
+    virtual void removeNode(Node<T>* node) {
         node->unlink();
-        delete node;
+        deleteNode(node);
         decSize();
     }
 
-    int indexOf(T data) {
+    int64_t indexOf(T data) {
         Node<T>* node = getFirstNode();
-        int index = 0;
+        int64_t index = 0;
         while (hasNext(node)) {
             if (node->getData() == data)
                 return index;
@@ -239,9 +423,9 @@ public:
         return -1;
     }
 
-    int lastIndexOf(T data) {
+    int64_t lastIndexOf(T data) {
         Node<T>* node = getLastNode();
-        int index = getMaxIndex();
+        int64_t index = getMaxIndex();
         while (hasPrev(node)) {
             if (node->getData() == data)
                 return index;
@@ -273,11 +457,11 @@ public:
         }
     }
 
-    bool removeNthOccurrenceFromFront(T data, int n) {
+    bool removeNthOccurrenceFromFront(T data, int64_t n) {
         if (n < 1 || n > getSize())
             return false;
 
-        int counter = 0;
+        int64_t counter = 0;
         Node<T>* node = getFirstNode();
         while (hasNext(node)) {
             if (node->getData() == data)
@@ -291,11 +475,11 @@ public:
         return false;
     }
 
-    bool removeNthOccurrenceFromBack(T data, int n) {
+    bool removeNthOccurrenceFromBack(T data, int64_t n) {
         if (n < 1 || n > getSize())
             return false;
 
-        int counter = 0;
+        int64_t counter = 0;
         Node<T>* node = getLastNode();
         while (hasPrev(node)) {
             if (node->getData() == data)
@@ -324,6 +508,17 @@ public:
         return hasRemoved;
     }
 
+    /**
+     * Prints the data of the node, or its address if T cannot be written to an ostream
+     * @param node
+     */
+    static void printData(Node<T>* node) {
+        if constexpr (requires { std::cout << node->getData(); })
+            std::cout << node->getData();
+        else
+            std::cout << "@" << node;
+    }
+
     virtual void debug_print() {
         if (isEmpty()) {
             std::cout << "QuickList @" << this << " is empty\n";
@@ -331,9 +526,11 @@ public:
         }
 
         Node<T>* node = getFirstNode();
-        int index = 0;
+        int64_t index = 0;
         while (hasNext(node)) {
-            std::cout << "Index " << index << ":\t" << node->getData() << "\n";
+            std::cout << "Index " << index << ":\t";
+            printData(node);
+            std::cout << "\n";
             node = node->getNextNode();
             index++;
         }
@@ -347,9 +544,11 @@ public:
         }
 
         Node<T>* node = getLastNode();
-        int index = getMaxIndex();
+        int64_t index = getMaxIndex();
         while (hasPrev(node)) {
-            std::cout << "Index " << index << ":\t" << node->getData() << "\n";
+            std::cout << "Index " << index << ":\t";
+            printData(node);
+            std::cout << "\n";
             node = node->getPrevNode();
         }
         std::cout << "\n";
@@ -0,0 +1,274 @@
+#include "quicklist.cpp"
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <random>
+#include <string>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ * Measures how much a fragmented heap slows down walking a QuickList and how much of that compact()
+ * wins back. The list is filled by appending, fragmented by random add/remove traffic and then scanned
+ * front to back before and after compaction. After every scan, get() is timed with random indices, which
+ * go through the JumpList, with sequential ones and with ones close to the previous index, which the
+ * TrailingPointer serves.
+ *
+ * Usage: QuickListBenchmark [size] [mixed operations] [--counters]
+ *
+ * With --counters, cycles, instructions, L1 data cache misses, last level cache misses and branch misses
+ * of every workload are read through perf_event_open and reported per operation below its timing.
+ */
+
+//Scans per throughput measurement, of which the best one counts
+constexpr int scanRepetitions = 5;
+
+/**
+ * Hardware counters of the calling thread, counting user space only. Counters that the kernel or the CPU
+ * does not provide stay closed, and if none can be opened, start() and stop() do nothing.
+ */
+class PerfCounters {
+public:
+    static constexpr int count = 5;
+    const char* names[count] = {"cycles", "instructions", "L1d misses", "LLC misses", "branch misses"};
+    int fds[count] = {-1, -1, -1, -1, -1};
+    //Values of the last measurement, scaled up if the kernel had to multiplex the counters
+    double values[count] = {};
+
+    explicit PerfCounters(bool enabled) {
+#ifdef __linux__
+        if (!enabled)
+            return;
+        const uint64_t l1dReadMiss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        const std::pair<uint32_t, uint64_t> events[count] = {
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+                {PERF_TYPE_HW_CACHE, l1dReadMiss},
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+                {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES}};
+        for (int i = 0; i < count; i++) {
+            perf_event_attr attr {};
+            attr.size = sizeof(attr);
+            attr.type = events[i].first;
+            attr.config = events[i].second;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            fds[i] = (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        }
+#else
+        (void) enabled;
+#endif
+    }
+
+    ~PerfCounters() {
+#ifdef __linux__
+        for (int fd : fds)
+            if (fd != -1)
+                close(fd);
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /**
+     * @return True if at least one counter could be opened
+     */
+    bool available() {
+        for (int fd : fds)
+            if (fd != -1)
+                return true;
+        return false;
+    }
+
+    void start() {
+#ifdef __linux__
+        for (int fd : fds) {
+            if (fd == -1)
+                continue;
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    void stop() {
+#ifdef __linux__
+        for (int i = 0; i < count; i++) {
+            if (fds[i] == -1)
+                continue;
+            ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+            //Value, time enabled and time running
+            uint64_t data[3] = {};
+            if (read(fds[i], data, sizeof(data)) != (ssize_t) sizeof(data) || data[2] == 0)
+                values[i] = 0;
+            else
+                values[i] = (double) data[0] * ((double) data[1] / (double) data[2]);
+        }
+#endif
+    }
+};
+
+/**
+ * Walks the whole list from the front like searchFromFront does.
+ * @return Sum of all elements, so that the walk cannot be optimised away
+ */
+int64_t scan(QuickList<int>& list) {
+    int64_t sum = 0;
+    Node<int>* node = list.getFirstNode();
+    while (list.hasNext(node)) {
+        sum += node->getData();
+        node = node->getNextNode();
+    }
+    return sum;
+}
+
+/**
+ * @return Nodes visited per second, taking the best of several scans
+ */
+double scanThroughput(QuickList<int>& list, int64_t& checksum, PerfCounters& counters) {
+    double best = 0;
+    counters.start();
+    for (int r = 0; r < scanRepetitions; r++) {
+        auto t1 = std::chrono::steady_clock::now();
+        checksum += scan(list);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t1).count();
+        if (seconds > 0)
+            best = std::max(best, list.getSize() / seconds);
+    }
+    counters.stop();
+    return best;
+}
+
+void report(const std::string& name, double perSecond, const std::string& unit = "nodes/s") {
+    std::cout << std::left << std::setw(32) << name << std::right
+    << std::setw(16) << (int64_t) perSecond << " " << unit << "\n";
+}
+
+/**
+ * Index patterns of the get() workloads
+ */
+enum GetPattern {
+    RANDOM,
+    SEQUENTIAL,
+    //Within 32 nodes of the previous index
+    NEAR_PREVIOUS
+};
+
+/**
+ * Times get() with indices of the given pattern, which are drawn before the measurement starts
+ * @return Operations per second
+ */
+double getThroughput(QuickList<int>& list, GetPattern pattern, int operations, std::mt19937& random,
+                     int64_t& checksum, PerfCounters& counters) {
+    std::vector<int64_t> indices((size_t) operations);
+    int64_t index = (int64_t) (random() % list.getSize());
+    for (int64_t& i : indices) {
+        if (pattern == RANDOM)
+            index = (int64_t) (random() % list.getSize());
+        else if (pattern == SEQUENTIAL)
+            index = (index + 1) % list.getSize();
+        else
+            index = std::clamp<int64_t>(index + (int64_t) (random() % 65) - 32, 0, list.getMaxIndex());
+        i = index;
+    }
+
+    counters.start();
+    auto t1 = std::chrono::steady_clock::now();
+    for (int64_t i : indices)
+        checksum += list.get(i);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t1).count();
+    counters.stop();
+    return seconds > 0 ? operations / seconds : 0;
+}
+
+/**
+ * Prints the counters of the last measurement divided by the number of operations it covered
+ * @param counters
+ * @param operations
+ * @param unit Name of one operation
+ */
+void reportCounters(PerfCounters& counters, int64_t operations, const std::string& unit) {
+    if (!counters.available() || operations == 0)
+        return;
+    std::cout << "    per " << unit << ":";
+    for (int i = 0; i < PerfCounters::count; i++)
+        if (counters.fds[i] != -1)
+            std::cout << " " << counters.names[i] << " " << std::fixed << std::setprecision(2)
+            << counters.values[i] / (double) operations;
+    std::cout << std::defaultfloat << "\n";
+}
+
+/**
+ * Runs and reports the get() workloads of all patterns, each with its own counters
+ */
+void reportGets(QuickList<int>& list, int operations, std::mt19937& random, int64_t& checksum, PerfCounters& counters) {
+    const char* names[] = {"  get(), random", "  get(), sequential", "  get(), near previous"};
+    for (GetPattern pattern : {RANDOM, SEQUENTIAL, NEAR_PREVIOUS}) {
+        report(names[pattern], getThroughput(list, pattern, operations, random, checksum, counters), "gets/s");
+        reportCounters(counters, operations, "get");
+    }
+}
+
+int main(int argc, char* argv[]) {
+    bool useCounters = false;
+    std::vector<std::string> arguments;
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]) == "--counters")
+            useCounters = true;
+        else
+            arguments.emplace_back(argv[i]);
+    }
+    int size = arguments.size() > 0 ? std::max(1, std::stoi(arguments[0])) : 1000000;
+    int operations = arguments.size() > 1 ? std::max(0, std::stoi(arguments[1])) : size / 5;
+
+    PerfCounters counters(useCounters);
+    if (useCounters && !counters.available())
+        std::cout << "Hardware counters are not available (see /proc/sys/kernel/perf_event_paranoid), reporting timings only\n";
+
+    std::mt19937 random(42);
+    QuickList<int> list;
+    for (int i = 0; i < size; i++)
+        list.append(i);
+
+    int64_t checksum = 0;
+    report("Freshly appended", scanThroughput(list, checksum, counters));
+    reportCounters(counters, scanRepetitions * list.getSize(), "node");
+    reportGets(list, operations, random, checksum, counters);
+
+    counters.start();
+    auto t1 = std::chrono::steady_clock::now();
+    for (int i = 0; i < operations; i++) {
+        list.remove((int) (random() % list.getSize()));
+        list.add((int) (random() % list.getSize()), i);
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    counters.stop();
+    std::cout << operations << " remove/add pairs took "
+    << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count() << "ms\n";
+    reportCounters(counters, operations, "pair");
+    report("Fragmented", scanThroughput(list, checksum, counters));
+    reportCounters(counters, scanRepetitions * list.getSize(), "node");
+    reportGets(list, operations, random, checksum, counters);
+
+    counters.start();
+    t1 = std::chrono::steady_clock::now();
+    list.compact();
+    t2 = std::chrono::steady_clock::now();
+    counters.stop();
+    std::cout << "compact() took " << std::chrono::duration_cast<std::chrono::milliseconds>(t2 - t1).count() << "ms\n";
+    reportCounters(counters, list.getSize(), "node");
+    report("Compacted", scanThroughput(list, checksum, counters));
+    reportCounters(counters, scanRepetitions * list.getSize(), "node");
+    reportGets(list, operations, random, checksum, counters);
+
+    std::cout << "\nChecksum " << checksum << "\n";
+    return 0;
+}
@@ -0,0 +1,22 @@
+#include "offsetquicklist.cpp"
+
+/**
+ * A QuickList that keeps its nodes in one contiguous heap arena and links them, as well as its
+ * JumpPointers, by 32-bit slot indices. A node of a QuickList<int> takes 24 bytes on 64-bit builds and
+ * every JumpPointer another 24 bytes, whereas a CompactQuickList<int> node takes 12 bytes and a
+ * JumpPointer 4 bytes. Neighbouring nodes also tend to share cache lines, which speeds up the walks
+ * from the JumpPointers to the searched node.
+ *
+ * @tparam T Element type, has to be trivially copyable
+ * @tparam Offset Unsigned integer type of the links, limits the list to 2^32 - 3 nodes by default
+ */
+template <typename T, typename Offset = uint32_t>
+class CompactQuickList : public OffsetQuickList<T, Offset, HeapRegion> {
+public:
+    CompactQuickList() {
+        this->initialize();
+    }
+
+    CompactQuickList(const CompactQuickList& other) = default;
+    CompactQuickList& operator=(const CompactQuickList&) = delete;
+};
@@ -0,0 +1,173 @@
+#include "quicklist.cpp"
+
+/**
+ * A map that keeps its entries in insertion order and also allows positional access. The entries live in a
+ * QuickList and a hash table maps each key to the node holding its entry, so looking a key up costs O(1),
+ * while accessing a position or finding the position of a key costs O(√n) through the JumpList.
+ * @tparam K Has to be default constructible and hashable by Hash
+ * @tparam V Has to be default constructible
+ * @tparam Hash
+ */
+template <typename K, typename V, typename Hash = std::hash<K>>
+class IndexedMap {
+public:
+    typedef std::pair<K, V> Entry;
+
+    QuickList<Entry> entries;
+    std::unordered_map<K, Node<Entry>*, Hash> nodes;
+
+    IndexedMap() = default;
+
+    /**
+     * Copies the entries of the other map and points the hash table at the copied nodes
+     * @param other
+     */
+    IndexedMap(const IndexedMap& other) : entries(other.entries) {
+        linkNodes();
+    }
+
+    IndexedMap(IndexedMap&& other) = default;
+
+    IndexedMap& operator=(const IndexedMap& other) {
+        if (this != &other) {
+            entries = other.entries;
+            linkNodes();
+        }
+        return *this;
+    }
+
+    IndexedMap& operator=(IndexedMap&& other) = default;
+
+    int64_t getSize() {
+        return entries.getSize();
+    }
+
+    bool isEmpty() {
+        return entries.isEmpty();
+    }
+
+    bool contains(const K& key) {
+        return nodes.find(key) != nodes.end();
+    }
+
+    /**
+     * @param key
+     * @return The value of the key, which stays valid until its entry is erased or moved, nullptr if there is none
+     */
+    V* find(const K& key) {
+        auto found = nodes.find(key);
+        return found == nodes.end() ? nullptr : &found->second->data.second;
+    }
+
+    /**
+     * Appends an entry for a key that is not in the map yet
+     * @param key
+     * @param value
+     * @return False if the key already has an entry, which is left unchanged
+     */
+    bool insert(const K& key, V value) {
+        if (contains(key))
+            return false;
+        nodes[key] = entries.append({key, std::move(value)});
+        return true;
+    }
+
+    /**
+     * Inserts an entry for a key that is not in the map yet at the given position. Positions out of range
+     * prepend or append like QuickList::add does.
+     * @param position
+     * @param key
+     * @param value
+     * @return False if the key already has an entry, which is left unchanged
+     */
+    bool insert(int64_t position, const K& key, V value) {
+        if (contains(key))
+            return false;
+        nodes[key] = entries.add(position, {key, std::move(value)});
+        return true;
+    }
+
+    /**
+     * Sets the value of a key, appending an entry if it has none
+     * @param key
+     * @param value
+     */
+    void set(const K& key, V value) {
+        V* found = find(key);
+        if (found != nullptr)
+            *found = std::move(value);
+        else
+            insert(key, std::move(value));
+    }
+
+    /**
+     * Removes the entry of a key in O(√n)
+     * @param key
+     * @return False if the key has no entry
+     */
+    bool erase(const K& key) {
+        auto found = nodes.find(key);
+        if (found == nodes.end())
+            return false;
+        entries.eraseAt(found->second);
+        nodes.erase(found);
+        return true;
+    }
+
+    /**
+     * @param position Has to be in range
+     * @return The entry at the position
+     */
+    Entry at(int64_t position) {
+        return entries.get(position);
+    }
+
+    /**
+     * @param key
+     * @return The position of the entry of the key, -1 if there is none
+     */
+    int64_t positionOf(const K& key) {
+        auto found = nodes.find(key);
+        return found == nodes.end() ? -1 : entries.indexOf(found->second);
+    }
+
+    /**
+     * Moves the entry of a key to a new position in O(√n), the entries in between move up or down by one.
+     * Positions out of range move the entry to the front or the back.
+     * @param key
+     * @param position Position of the entry afterwards
+     * @return False if the key has no entry
+     */
+    bool move(const K& key, int64_t position) {
+        auto found = nodes.find(key);
+        if (found == nodes.end())
+            return false;
+        Entry entry = std::move(found->second->data);
+        entries.eraseAt(found->second);
+        found->second = entries.add(position, std::move(entry));
+        return true;
+    }
+
+    /**
+     * @return A view over all entries in insertion order, see QuickList::slice
+     */
+    Slice<Entry> view() {
+        return entries.slice(0, entries.getSize());
+    }
+
+    void clear() {
+        entries.clear();
+        nodes.clear();
+    }
+
+private:
+    /**
+     * Rebuilds the hash table from the entries in O(n)
+     */
+    void linkNodes() {
+        nodes.clear();
+        nodes.reserve((size_t) entries.getSize());
+        for (Node<Entry>* node = entries.getFirstNode(); entries.hasNext(node); node = node->getNextNode())
+            nodes[node->data.first] = node;
+    }
+};
@@ -3,9 +3,14 @@
 /**
  * The essence of QuickSearch. Stores JumpPointers that point to evenly spaced out nodes in the QuickList.
  */
-template <typename T>
-class JumpList : public BaseList<Node<T>*> {
+template <typename T, typename Allocator = std::allocator<T>>
+class JumpList : public BaseList<Node<T>*, typename std::allocator_traits<Allocator>::template rebind_alloc<Node<T>*>> {
 public:
+    typedef BaseList<Node<T>*, typename std::allocator_traits<Allocator>::template rebind_alloc<Node<T>*>> Base;
+
+    JumpList() = default;
+
+    explicit JumpList(const Allocator& allocator) : Base(allocator) {}
     /**
      * Has to be used in place of hasNext() to ensure that the tail of the JumpList will not be selected
      * @param jumpPointer
@@ -24,56 +29,37 @@ public:
     }
 
     /**
-     * Shifts all affected JumpPointers to the left to accommodate for a new node in the QuickList
-     * @param distance JumpPointer distance
-     * @param index
+     * Shifts the given JumpPointer and all following ones to the previous node to accommodate for a new node in the QuickList
      * @param jumpPointer The first affected JumpPointer
      */
-    void leftPointerShift(int distance, int index, Node<Node<T>*>* jumpPointer) {
-        if (jumpPointer == nullptr || jumpPointer == this->getTail())
-            return;
-
-        if (jumpPointer == this->getHead())
-            jumpPointer = this->getFirstNode();
-
-        if (index < distance)
+    void leftPointerShift(Node<Node<T>*>* jumpPointer) {
+        while (jumpPointer != this->getTail()) {
             jumpPointer->setData(jumpPointer->getData()->getPrevNode());
-
-        while (this->hasNextJump(jumpPointer)) {
-            jumpPointer->getNextNode()->setData(this->getPrevNodeOfNextJumpData(jumpPointer));
             jumpPointer = jumpPointer->getNextNode();
         }
     }
 
     /**
-     * Shifts all affected JumpPointers to the right to accommodate for a removed node in the QuickList
-     * @param distance JumpPointer distance
-     * @param index
+     * Shifts the given JumpPointer and all following ones to the next node to accommodate for a removed node in the QuickList
      * @param jumpPointer The first affected JumpPointer
      */
-    void rightPointerShift(int distance, int index, Node<Node<T>*>* jumpPointer) {
-        if (jumpPointer == this->getHead() || jumpPointer == this->getTail())
-            return;
-
-        if (index < distance)
+    void rightPointerShift(Node<Node<T>*>* jumpPointer) {
+        while (jumpPointer != this->getTail()) {
             jumpPointer->setData(jumpPointer->getData()->getNextNode());
-
-        while (this->hasNextJump(jumpPointer)) {
-            jumpPointer->getNextNode()->setData(this->getNextNodeOfNextJumpData(jumpPointer));
             jumpPointer = jumpPointer->getNextNode();
         }
     }
 
-    void debug_print(int distance)  {
+    void debug_print(int64_t distance, int64_t origin = 0)  {
         if (this->isEmpty()) {
             std::cout << "JumpList @" << this << " is empty\n";
             return;
         }
 
         Node<Node<T>*>* node = this->getFirstNode();
-        int index = 0;
+        int64_t index = 0;
         while (this->hasNext(node)) {
-            std::cout << "Index " << index << " -> Index " << index * distance + distance - 1 << ":\t" << node->getData()->getData() << "\n";
+            std::cout << "Index " << index << " -> Index " << index * distance + distance - 1 - origin << ":\t" << node->getData()->getData() << "\n";
             node = node->getNextNode();
             index++;
         }
@@ -0,0 +1,192 @@
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * Hands out nodes from blocks of consecutive slots. Nodes that are allocated one after another, e.g. by
+ * appending, lie next to each other in memory and share cache lines. Released slots are reused before
+ * the newest block is used up, blocks themselves are only freed all at once by reset().
+ * @tparam NodeType
+ * @tparam Allocator Allocator the blocks are taken from, rebound to the slot type
+ */
+template <typename NodeType, typename Allocator = std::allocator<NodeType>>
+class NodePool {
+public:
+    typedef union Slot {
+        Slot* nextFree;
+        alignas(NodeType) unsigned char storage[sizeof(NodeType)];
+    } Slot;
+
+    typedef struct Block {
+        Slot* slots;
+        size_t capacity;
+    } Block;
+
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Slot> SlotAllocator;
+    typedef typename std::allocator_traits<Allocator>::template rebind_alloc<Block> BlockAllocator;
+    typedef std::allocator_traits<SlotAllocator> SlotTraits;
+
+    static constexpr size_t firstBlockCapacity = 16;
+    static constexpr size_t maxBlockCapacity = 1 << 16;
+
+    SlotAllocator allocator;
+    std::vector<Block, BlockAllocator> blocks;
+    Slot* freeSlots = nullptr;
+    //Slots at the end of the newest block that have never been handed out
+    size_t unusedSlots = 0;
+    //Slots in freeSlots
+    size_t releasedSlots = 0;
+
+    NodePool() : NodePool(Allocator()) {}
+
+    template <typename A>
+    explicit NodePool(const A& blockAllocator) : allocator(blockAllocator), blocks(BlockAllocator(blockAllocator)) {}
+
+    NodePool(const NodePool&) = delete;
+    NodePool& operator=(const NodePool&) = delete;
+
+    NodePool(NodePool&& other) noexcept :
+    allocator(other.allocator),
+    blocks(std::move(other.blocks)),
+    freeSlots(other.freeSlots),
+    unusedSlots(other.unusedSlots),
+    releasedSlots(other.releasedSlots) {
+        other.blocks.clear();
+        other.freeSlots = nullptr;
+        other.unusedSlots = 0;
+        other.releasedSlots = 0;
+    }
+
+    ~NodePool() {
+        reset();
+    }
+
+    Allocator getAllocator() const {
+        return Allocator(allocator);
+    }
+
+    /**
+     * Swaps the blocks of both pools. The allocators have to compare equal unless they propagate on swap.
+     * @param other
+     */
+    void swap(NodePool& other) noexcept {
+        if constexpr (SlotTraits::propagate_on_container_swap::value)
+            std::swap(allocator, other.allocator);
+        blocks.swap(other.blocks);
+        std::swap(freeSlots, other.freeSlots);
+        std::swap(unusedSlots, other.unusedSlots);
+        std::swap(releasedSlots, other.releasedSlots);
+    }
+
+    /**
+     * @return A value-initialised node, taken from the released slots if there are any
+     */
+    NodeType* allocate() {
+        Slot* slot;
+        if (freeSlots != nullptr) {
+            slot = freeSlots;
+            freeSlots = slot->nextFree;
+            releasedSlots--;
+        } else {
+            if (unusedSlots == 0)
+                addBlock(blocks.empty() ? firstBlockCapacity : std::min(blocks.back().capacity * 2, maxBlockCapacity));
+            Block& block = blocks.back();
+            slot = block.slots + (block.capacity - unusedSlots--);
+        }
+        return new (slot->storage) NodeType();
+    }
+
+    /**
+     * Destroys the node and keeps its slot for the next allocation
+     * @param node
+     */
+    void release(NodeType* node) {
+        node->~NodeType();
+        auto* slot = reinterpret_cast<Slot*>(node);
+        slot->nextFree = freeSlots;
+        freeSlots = slot;
+        releasedSlots++;
+    }
+
+    /**
+     * Destroys the node without keeping its slot. Only useful right before reset().
+     * @param node
+     */
+    void destroy(NodeType* node) {
+        node->~NodeType();
+    }
+
+    /**
+     * Allocates a node outside of the blocks, which survives reset(). Used for sentinels.
+     * @return A value-initialised node
+     */
+    NodeType* allocateSentinel() {
+        Slot* slot = SlotTraits::allocate(allocator, 1);
+        return new (slot->storage) NodeType();
+    }
+
+    void releaseSentinel(NodeType* node) {
+        node->~NodeType();
+        SlotTraits::deallocate(allocator, reinterpret_cast<Slot*>(node), 1);
+    }
+
+    /**
+     * Makes sure that the next count allocations are served from consecutive slots of a single block,
+     * provided that no slots have been released in the meantime.
+     * @param count
+     */
+    void reserve(size_t count) {
+        if (count > unusedSlots)
+            addBlock(count);
+    }
+
+    void addBlock(size_t capacity) {
+        blocks.push_back({SlotTraits::allocate(allocator, capacity), capacity});
+        unusedSlots = capacity;
+    }
+
+    /**
+     * Frees all blocks. Every node handed out must have been released or destroyed before.
+     */
+    void reset() {
+        for (Block& block : blocks)
+            SlotTraits::deallocate(allocator, block.slots, block.capacity);
+        blocks.clear();
+        freeSlots = nullptr;
+        unusedSlots = 0;
+        releasedSlots = 0;
+    }
+
+    /**
+     * @return Number of slots in all blocks
+     */
+    size_t capacity() const {
+        size_t slots = 0;
+        for (const Block& block : blocks)
+            slots += block.capacity;
+        return slots;
+    }
+
+    /**
+     * @return Number of slots in the blocks that no node is using, released or never handed out
+     */
+    size_t freeSlotCount() const {
+        return releasedSlots + unusedSlots;
+    }
+
+    /**
+     * @return Bytes of the slots in use and of the block bookkeeping, sentinels excluded
+     */
+    size_t usedBytes() const {
+        return (capacity() - freeSlotCount()) * sizeof(Slot) + blocks.capacity() * sizeof(Block);
+    }
+
+    /**
+     * @return Bytes of the slots that no node is using, which only reset() gives back
+     */
+    size_t freeBytes() const {
+        return freeSlotCount() * sizeof(Slot);
+    }
+};
@@ -0,0 +1,474 @@
+#ifndef QUICKLIST_OFFSETQUICKLIST_CPP
+#define QUICKLIST_OFFSETQUICKLIST_CPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * Heap memory for an OffsetQuickList, grown with realloc
+ */
+class HeapRegion {
+public:
+    char* base = nullptr;
+    size_t length = 0;
+    bool readOnly = false;
+
+    HeapRegion() = default;
+
+    HeapRegion(const HeapRegion& other) {
+        if (other.base != nullptr && grow(other.length))
+            std::memcpy(base, other.base, length);
+    }
+
+    HeapRegion& operator=(const HeapRegion& other) = delete;
+
+    /**
+     * @param newLength
+     * @return True if the region has at least newLength bytes now
+     */
+    bool grow(size_t newLength) {
+        if (newLength <= length)
+            return true;
+        auto* grown = (char*) std::realloc(base, newLength);
+        if (grown == nullptr)
+            return false;
+        base = grown;
+        length = newLength;
+        return true;
+    }
+
+    ~HeapRegion() {
+        std::free(base);
+    }
+};
+
+/**
+ * A QuickList whose nodes and jump table live in one contiguous region of equally sized slots.
+ *
+ * Slot 0 onwards holds the header, every other slot holds a node, a free slot or part of the jump table.
+ * Nodes are linked by slot offsets instead of pointers, so the region can be moved or mapped at any
+ * address. The jump table is an array of node offsets, entry k pointing to the node at index
+ * k * distance + distance - 1, and is sized on every rebuild to hold all JumpPointers until the next
+ * upper critical size.
+ *
+ * Only trivially copyable types can be stored, as the region is grown by copying its bytes.
+ *
+ * @tparam T Element type
+ * @tparam Offset Unsigned integer type of the links, uint32_t halves the link overhead but limits the
+ * region to 2^32 slots
+ * @tparam Region Provides the memory: base, length, readOnly and grow(size_t)
+ */
+template <typename T, typename Offset, typename Region>
+class OffsetQuickList {
+public:
+    static_assert(std::is_trivially_copyable_v<T>, "OffsetQuickList can only store trivially copyable types");
+    static_assert(std::is_unsigned_v<Offset>, "Offsets have to be unsigned integers");
+
+    typedef struct Slot {
+        T data;
+        Offset prev;
+        Offset next;
+    } Slot;
+
+    typedef struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t elementSize;
+        uint32_t offsetSize;
+        uint64_t slotCount;
+        uint64_t usedSlots;
+        uint64_t freeList;
+        uint64_t head;
+        uint64_t tail;
+        int64_t size;
+        int64_t distance;
+        uint64_t jumpTable;
+        int64_t jumpCount;
+        int64_t jumpCapacity;
+    } Header;
+
+    static constexpr char regionMagic[4] = {'Q', 'L', 'O', 'L'};
+    static constexpr uint32_t regionVersion = 1;
+    static constexpr uint64_t headerSlots = (sizeof(Header) + sizeof(Slot) - 1) / sizeof(Slot);
+    static constexpr uint64_t initialSlots = 256;
+
+    Region region;
+
+    bool isOpen() {
+        return region.base != nullptr;
+    }
+
+    bool isReadOnly() {
+        return region.readOnly;
+    }
+
+    Header& header() {
+        return *reinterpret_cast<Header*>(region.base);
+    }
+
+    Slot& slot(Offset offset) {
+        return reinterpret_cast<Slot*>(region.base)[offset];
+    }
+
+    Offset* jumpTable() {
+        return reinterpret_cast<Offset*>(&slot((Offset) header().jumpTable));
+    }
+
+    static uint64_t slotsFor(int64_t jumpCapacity) {
+        return (jumpCapacity * sizeof(Offset) + sizeof(Slot) - 1) / sizeof(Slot);
+    }
+
+    bool initialize() {
+        if (!region.grow(initialSlots * sizeof(Slot)))
+            return false;
+
+        Header& h = header();
+        std::memset(&h, 0, sizeof(Header));
+        std::copy(regionMagic, regionMagic + 4, h.magic);
+        h.version = regionVersion;
+        h.elementSize = sizeof(T);
+        h.offsetSize = sizeof(Offset);
+        h.slotCount = initialSlots;
+        h.usedSlots = headerSlots;
+
+        Offset head = allocateSlot();
+        Offset tail = allocateSlot();
+        header().head = head;
+        header().tail = tail;
+        slot(head) = {T{}, 0, tail};
+        slot(tail) = {T{}, head, 0};
+        return allocateJumpTable(10);
+    }
+
+    /**
+     * Takes a slot from the free list, or from the end of the used area, growing the region if needed.
+     * Any Slot reference obtained before calling this may be invalidated.
+     * @return Offset of the slot, 0 if the region could not grow
+     */
+    Offset allocateSlot() {
+        Header* h = &header();
+        if (h->freeList != 0) {
+            Offset offset = (Offset) h->freeList;
+            h->freeList = slot(offset).next;
+            return offset;
+        }
+        if (!reserve(1))
+            return 0;
+        h = &header();
+        return (Offset) h->usedSlots++;
+    }
+
+    void freeSlot(Offset offset) {
+        slot(offset).next = (Offset) header().freeList;
+        header().freeList = offset;
+    }
+
+    /**
+     * Makes sure that the given amount of slots is available behind the used area
+     * @param count
+     * @return False if the region could not grow or the offsets would overflow
+     */
+    bool reserve(uint64_t count) {
+        Header& h = header();
+        if (h.usedSlots + count <= h.slotCount)
+            return true;
+
+        uint64_t slotCount = std::max(h.slotCount * 2, h.usedSlots + count);
+        if (slotCount - 1 > (uint64_t) (Offset) -1)
+            return false;
+        if (!region.grow(slotCount * sizeof(Slot)))
+            return false;
+        header().slotCount = slotCount;
+        return true;
+    }
+
+    /**
+     * Replaces the jump table by an empty one that can hold all JumpPointers up to the upper critical size
+     * of the given distance and switches to that distance. The slots of the old table are returned to the
+     * free list.
+     * @param distance
+     * @return False if the region could not grow, nothing is changed then
+     */
+    bool allocateJumpTable(int64_t distance) {
+        int64_t capacity = (distance * distance + 10 * distance) / distance + 1;
+        uint64_t slots = slotsFor(capacity);
+        if (!reserve(slots))
+            return false;
+
+        Header& grown = header();
+        uint64_t oldTable = grown.jumpTable;
+        uint64_t oldSlots = oldTable != 0 ? slotsFor(grown.jumpCapacity) : 0;
+        grown.jumpTable = grown.usedSlots;
+        grown.usedSlots += slots;
+        grown.jumpCapacity = capacity;
+        grown.jumpCount = 0;
+        grown.distance = distance;
+        for (uint64_t i = 0; i < oldSlots; i++)
+            freeSlot((Offset) (oldTable + i));
+        return true;
+    }
+
+    int64_t getSize() {
+        return isOpen() ? header().size : 0;
+    }
+
+    bool isEmpty() {
+        return getSize() == 0;
+    }
+
+    int64_t getDistance() {
+        return header().distance;
+    }
+
+    /**
+     * @param n Non-negative
+     * @return The largest integer whose square is not greater than n, exact for all 64-bit values
+     */
+    static int64_t integerSqrt(int64_t n) {
+        if (n < 2)
+            return n;
+        //Compares by division, as squaring the estimate can overflow near the 64-bit maximum
+        auto x = (int64_t) std::sqrt((double) n);
+        while (x > n / x)
+            x--;
+        while (x + 1 <= n / (x + 1))
+            x++;
+        return x;
+    }
+
+    int64_t calcDistance(int64_t size) {
+        int64_t x = integerSqrt(25 + size) - 5;
+        x -= x % 10;
+        return x + 10;
+    }
+
+    int64_t upperCritical() {
+        int64_t distance = header().distance;
+        return distance * distance + 10 * distance;
+    }
+
+    int64_t lowerCritical() {
+        int64_t distance = header().distance;
+        return distance * distance - 10 * distance - 50;
+    }
+
+    /**
+     * Rebuilds the jump table in a single pass if the upper or lower critical size has been reached
+     * @return True if the jump table has been rebuilt
+     */
+    bool rebuildJumpTable() {
+        Header& h = header();
+        if (h.size < upperCritical() && h.size > lowerCritical())
+            return false;
+
+        if (!allocateJumpTable(calcDistance(h.size)))
+            return false;
+
+        Header& rebuilt = header();
+        Offset* jumps = jumpTable();
+        Offset node = slot((Offset) rebuilt.head).next;
+        for (int64_t index = 1; node != rebuilt.tail; index++) {
+            if (index % rebuilt.distance == 0)
+                jumps[rebuilt.jumpCount++] = node;
+            node = slot(node).next;
+        }
+        return true;
+    }
+
+    /**
+     * Walks to the node at the given index, starting from whichever is nearest: head, tail,
+     * the previous JumpPointer or the next JumpPointer.
+     * @param index Has to be in range
+     * @return Offset of the node
+     */
+    Offset locate(int64_t index) {
+        Header& h = header();
+        Offset* jumps = jumpTable();
+
+        Offset node = (Offset) h.head;
+        int64_t steps = index + 1;
+        if (h.size - index < steps) {
+            node = (Offset) h.tail;
+            steps = index - h.size;
+        }
+
+        int64_t prevJump = (index + 1) / h.distance - 1;
+        if (prevJump >= 0 && prevJump < h.jumpCount) {
+            int64_t jumpIndex = (prevJump + 1) * h.distance - 1;
+            if (index - jumpIndex < std::abs(steps)) {
+                node = jumps[prevJump];
+                steps = index - jumpIndex;
+            }
+        }
+        if (prevJump + 1 < h.jumpCount) {
+            int64_t jumpIndex = (prevJump + 2) * h.distance - 1;
+            if (jumpIndex - index < std::abs(steps)) {
+                node = jumps[prevJump + 1];
+                steps = index - jumpIndex;
+            }
+        }
+
+        for (; steps > 0; steps--)
+            node = slot(node).next;
+        for (; steps < 0; steps++)
+            node = slot(node).prev;
+        return node;
+    }
+
+    /**
+     * @param index
+     * @return The element at the given index or a value-initialized T if the index is out of range
+     */
+    T get(int64_t index) {
+        if (index < 0 || index >= getSize())
+            return T{};
+        return slot(locate(index)).data;
+    }
+
+    T getFirst() {
+        return get(0);
+    }
+
+    T getLast() {
+        return get(getSize() - 1);
+    }
+
+    void set(int64_t index, T data) {
+        if (isReadOnly() || index < 0 || index >= getSize())
+            return;
+        slot(locate(index)).data = data;
+    }
+
+    /**
+     * Links a new node in front of the given node
+     * @return Offset of the new node, 0 if the region could not grow
+     */
+    Offset linkBefore(Offset next, T data) {
+        Offset node = allocateSlot();
+        if (node == 0)
+            return 0;
+        Offset prev = slot(next).prev;
+        slot(node) = {data, prev, next};
+        slot(prev).next = node;
+        slot(next).prev = node;
+        header().size++;
+        return node;
+    }
+
+    /**
+     * Appends a JumpPointer or rebuilds the jump table after a node has been linked.
+     * If the region could not grow for a rebuild, the trailing JumpPointers are left out; searches stay
+     * correct as they only use existing JumpPointers.
+     */
+    void afterInsert() {
+        if (rebuildJumpTable())
+            return;
+        Header& h = header();
+        if (h.size % h.distance == 0 && h.jumpCount < h.jumpCapacity)
+            jumpTable()[h.jumpCount++] = slot((Offset) h.tail).prev;
+    }
+
+    /**
+     * Shifts all JumpPointers at or behind the index to the previous node to accommodate for a new node
+     * @param index
+     */
+    void leftPointerShift(int64_t index) {
+        Header& h = header();
+        Offset* jumps = jumpTable();
+        for (int64_t k = index / h.distance; k < h.jumpCount; k++)
+            jumps[k] = slot(jumps[k]).prev;
+    }
+
+    /**
+     * Shifts all JumpPointers at or behind the index to the next node to accommodate for a removed node
+     * @param index
+     */
+    void rightPointerShift(int64_t index) {
+        Header& h = header();
+        Offset* jumps = jumpTable();
+        for (int64_t k = index / h.distance; k < h.jumpCount; k++)
+            jumps[k] = slot(jumps[k]).next;
+    }
+
+    bool append(T data) {
+        if (!isOpen() || isReadOnly() || linkBefore((Offset) header().tail, data) == 0)
+            return false;
+        afterInsert();
+        return true;
+    }
+
+    bool prepend(T data) {
+        if (!isOpen() || isReadOnly())
+            return false;
+        Offset first = slot((Offset) header().head).next;
+        if (linkBefore(first, data) == 0)
+            return false;
+        leftPointerShift(0);
+        afterInsert();
+        return true;
+    }
+
+    /**
+     * Adds a new node taking the given index and shifts the JumpPointers behind it
+     * @param index
+     * @param data
+     * @return False if the list is read-only or the region could not grow
+     */
+    bool add(int64_t index, T data) {
+        if (index <= 0)
+            return prepend(data);
+        if (index >= getSize())
+            return append(data);
+        if (isReadOnly() || linkBefore(locate(index), data) == 0)
+            return false;
+        leftPointerShift(index);
+        afterInsert();
+        return true;
+    }
+
+    /**
+     * Removes the node at the given index and shifts the JumpPointers behind it
+     * @param index
+     */
+    void remove(int64_t index) {
+        if (isReadOnly() || index < 0 || index >= getSize())
+            return;
+
+        Offset node = locate(index);
+        rightPointerShift(index);
+
+        Slot& removed = slot(node);
+        slot(removed.prev).next = removed.next;
+        slot(removed.next).prev = removed.prev;
+        freeSlot(node);
+
+        Header& h = header();
+        h.size--;
+        if (!rebuildJumpTable() && h.size % h.distance == h.distance - 1)
+            h.jumpCount--;
+    }
+
+    void removeFirst() {
+        remove(0);
+    }
+
+    void removeLast() {
+        remove(getSize() - 1);
+    }
+
+    /**
+     * Removes all nodes. The region keeps its size, the slots are reused by later insertions.
+     */
+    void clear() {
+        if (isReadOnly())
+            return;
+        while (!isEmpty())
+            removeLast();
+    }
+};
+
+#endif
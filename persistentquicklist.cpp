@@ -0,0 +1,202 @@
+#include "offsetquicklist.cpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * A file that is mapped into memory as a whole and can grow. Its contents must only be addressed by
+ * offsets, because growing the region may map it at a different address. If mapping fails, the previous
+ * mapping stays in place, so the region always describes memory that is actually mapped.
+ */
+class MappedRegion {
+public:
+    int fd = -1;
+    char* base = nullptr;
+    size_t length = 0;
+    bool readOnly = false;
+
+    /**
+     * Opens (or creates, unless read-only) the file and maps all of it.
+     * @param path
+     * @param readOnlyAccess Maps the file with PROT_READ only, so that it can be shared between processes
+     * @return True if the file has been opened and mapped
+     */
+    bool open(const char* path, bool readOnlyAccess) {
+        close();
+        readOnly = readOnlyAccess;
+        fd = ::open(path, readOnly ? O_RDONLY : O_RDWR | O_CREAT, 0644);
+        if (fd < 0)
+            return false;
+
+        struct stat st {};
+        if (fstat(fd, &st) != 0) {
+            close();
+            return false;
+        }
+        if (st.st_size > 0 && !remap((size_t) st.st_size)) {
+            close();
+            return false;
+        }
+        return true;
+    }
+
+    bool isOpen() {
+        return fd >= 0;
+    }
+
+    /**
+     * Maps the first newLength bytes of the file and only then unmaps the old mapping, which is kept if
+     * the new one cannot be created.
+     * @param newLength
+     * @return True if the region has been mapped with the new length
+     */
+    bool remap(size_t newLength) {
+        void* address = mmap(nullptr, newLength, readOnly ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (address == MAP_FAILED)
+            return false;
+        if (base != nullptr)
+            munmap(base, length);
+        base = (char*) address;
+        length = newLength;
+        return true;
+    }
+
+    /**
+     * Extends the file and maps it again. Pointers into the region become invalid, offsets stay valid.
+     * @param newLength
+     * @return True if the region has at least newLength bytes now, the old mapping is left unchanged otherwise
+     */
+    bool grow(size_t newLength) {
+        if (readOnly)
+            return false;
+        if (newLength <= length)
+            return true;
+        if (ftruncate(fd, (off_t) newLength) != 0)
+            return false;
+        return remap(newLength);
+    }
+
+    /**
+     * Writes dirty pages back to the file.
+     * @param async Only schedules the write-back if true
+     * @return True on success
+     */
+    bool flush(bool async) {
+        if (base == nullptr || readOnly)
+            return base != nullptr;
+        return msync(base, length, async ? MS_ASYNC : MS_SYNC) == 0;
+    }
+
+    void close() {
+        if (base != nullptr)
+            munmap(base, length);
+        if (fd >= 0)
+            ::close(fd);
+        base = nullptr;
+        fd = -1;
+        length = 0;
+    }
+
+    ~MappedRegion() {
+        close();
+    }
+};
+
+/**
+ * A QuickList whose nodes and jump table live in a memory-mapped file and outlive the process.
+ *
+ * The file holds the slots of an OffsetQuickList as they are. Opening an existing file only maps it and
+ * checks the header, nothing is rebuilt and pages are only faulted in when a search touches them.
+ * Several processes may open the same file read-only. The header is shared with the writer, so a reader
+ * maps the file again before each read once the writer has grown it beyond the reader's mapping. Reads
+ * are not synchronized with writes: a reader only sees a consistent list while no write is in progress,
+ * e.g. after the writer has closed the file or by coordinating with it through other means.
+ *
+ * @tparam T Element type, has to be trivially copyable
+ * @tparam Offset Unsigned integer type of the links, uint32_t halves the link overhead but limits the
+ * file to 2^32 slots
+ */
+template <typename T, typename Offset = uint64_t>
+class PersistentQuickList : public OffsetQuickList<T, Offset, MappedRegion> {
+public:
+    typedef OffsetQuickList<T, Offset, MappedRegion> Base;
+
+    PersistentQuickList() = default;
+
+    PersistentQuickList(const PersistentQuickList&) = delete;
+    PersistentQuickList& operator=(const PersistentQuickList&) = delete;
+
+    /**
+     * Opens an existing list in O(1) or creates an empty one if the file is empty or does not exist.
+     * @param path
+     * @param readOnly Opens the list for reading only; mutating operations are ignored then
+     * @return False if the file could not be mapped or holds a list of a different element or offset type
+     */
+    bool open(const char* path, bool readOnly = false) {
+        if (!this->region.open(path, readOnly))
+            return false;
+
+        if (this->region.length == 0) {
+            if (readOnly || !this->initialize()) {
+                this->region.close();
+                return false;
+            }
+            return true;
+        }
+
+        typename Base::Header& h = this->header();
+        if (this->region.length < sizeof(typename Base::Header) ||
+        !std::equal(Base::regionMagic, Base::regionMagic + 4, h.magic) ||
+        h.version != Base::regionVersion ||
+        h.elementSize != sizeof(T) ||
+        h.offsetSize != sizeof(Offset) ||
+        h.slotCount * sizeof(typename Base::Slot) > this->region.length) {
+            this->region.close();
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Maps the file again if the writer has grown it beyond the mapped length, so that all offsets in the
+     * header point into the mapping
+     * @return False if the list is not open or the grown file could not be mapped
+     */
+    bool followGrowth() {
+        if (!this->isOpen())
+            return false;
+        size_t length = this->header().slotCount * sizeof(typename Base::Slot);
+        return length <= this->region.length || this->region.remap(length);
+    }
+
+    /**
+     * @param index
+     * @return The element at the given index or a value-initialized T if the index is out of range or the
+     * grown file could not be mapped
+     */
+    T get(int64_t index) {
+        return followGrowth() ? Base::get(index) : T{};
+    }
+
+    T getFirst() {
+        return get(0);
+    }
+
+    T getLast() {
+        return get(this->getSize() - 1);
+    }
+
+    /**
+     * Flushes all modifications to the file by means of msync.
+     * @param async Only schedules the write-back if true
+     * @return True on success
+     */
+    bool flush(bool async = false) {
+        return this->region.flush(async);
+    }
+
+    void close() {
+        this->region.close();
+    }
+};
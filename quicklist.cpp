@@ -1,19 +1,481 @@
+#ifndef QUICKLIST_QUICKLIST_CPP
+#define QUICKLIST_QUICKLIST_CPP
+
 #include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <cmath>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <ranges>
+#include <span>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 #include "jumplist.cpp"
+#include "tracerecorder.cpp"
+#include "serializer.cpp"
+
+/**
+ * Read-only forward iterator over a fixed number of consecutive nodes. It ends by counting down instead of
+ * comparing against a node, so it never touches the node behind the last one it visits. Writes have to go
+ * through QuickList::set, which keeps snapshots, the value index and fingerprints up to date.
+ * @tparam T
+ */
+template <typename T>
+class SliceIterator {
+public:
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+
+    Node<T>* node = nullptr;
+    int64_t remaining = 0;
+    //Walks towards the head instead, for slices of a reversed QuickList
+    bool backward = false;
+
+    SliceIterator() = default;
+
+    SliceIterator(Node<T>* first, int64_t count, bool backward = false) : node(first), remaining(count), backward(backward) {}
+
+    const T& operator*() const {
+        return node->data;
+    }
+
+    SliceIterator& operator++() {
+        if (--remaining > 0)
+            node = backward ? node->getPrevNode() : node->getNextNode();
+        return *this;
+    }
+
+    SliceIterator operator++(int) {
+        SliceIterator previous = *this;
+        ++*this;
+        return previous;
+    }
+
+    bool operator==(const SliceIterator& other) const {
+        return remaining == other.remaining && (remaining == 0 || node == other.node);
+    }
+
+    bool operator==(std::default_sentinel_t) const {
+        return remaining == 0;
+    }
+
+    friend difference_type operator-(std::default_sentinel_t, const SliceIterator& it) {
+        return it.remaining;
+    }
+
+    friend difference_type operator-(const SliceIterator& it, std::default_sentinel_t) {
+        return -it.remaining;
+    }
+};
+
+/**
+ * Non-owning read-only view over the nodes of a QuickList between two indices, see QuickList::slice.
+ * Copying a Slice copies two words; the elements are neither copied nor allocated.
+ * @tparam T
+ */
+template <typename T>
+class Slice : public std::ranges::view_interface<Slice<T>> {
+public:
+    Node<T>* first = nullptr;
+    int64_t count = 0;
+    bool backward = false;
+
+    Slice() = default;
+
+    Slice(Node<T>* firstNode, int64_t nodeCount, bool backward = false) : first(firstNode), count(nodeCount), backward(backward) {}
+
+    SliceIterator<T> begin() const {
+        return {first, count, backward};
+    }
+
+    std::default_sentinel_t end() const {
+        return {};
+    }
+};
+
+template <typename T>
+inline constexpr bool std::ranges::enable_borrowed_range<Slice<T>> = true;
+
+/**
+ * The state shared between a QuickList and the QuickListSnapshots taken from it. The snapshot is split
+ * into the segments between the JumpPointers at the time it was taken. A segment is read from the live
+ * nodes until a writer is about to modify one of them; the writer copies the segment's elements first.
+ * The writer tracks the current index of every segment in a Fenwick tree, so finding the segment of a
+ * modified index costs O(log n) and shifting all segments behind an insertion or removal does as well.
+ * @tparam T
+ */
+template <typename T>
+class SnapshotSegments {
+public:
+    int64_t size;
+    int64_t distance;
+    int64_t origin;
+    //True if the list was reversed, the segments are still in the order of the nodes
+    bool reversed;
+
+    //First node of each segment, never modified after the snapshot has been taken
+    std::vector<Node<T>*> starts;
+
+    //Copied elements of each segment, nullptr while the segment is shared with the list. Guarded by mutex.
+    std::vector<std::shared_ptr<const std::vector<T>>> copies;
+    std::mutex mutex;
+
+    //The members below are only used by the writer
+    //True for each segment that is still read from the live nodes
+    std::vector<bool> shared;
+    int64_t sharedCount = 0;
+    //Segment at each position in the order of the list, which differs from the snapshot's after rotations
+    std::vector<int64_t> order;
+    //Fenwick tree over the positions in order, whose prefix sums are the current indices of the segments' first nodes
+    std::vector<int64_t> indexTree;
+
+    SnapshotSegments(int64_t snapshotSize, int64_t snapshotDistance, int64_t snapshotOrigin, bool snapshotReversed) :
+    size(snapshotSize), distance(snapshotDistance), origin(snapshotOrigin), reversed(snapshotReversed) {}
+
+    int64_t segmentStart(int64_t segment) {
+        return std::max<int64_t>(0, segment * distance - origin);
+    }
+
+    int64_t segmentLength(int64_t segment) {
+        return std::min(segmentStart(segment + 1), size) - segmentStart(segment);
+    }
+
+    int64_t segmentOf(int64_t index) {
+        return (index + origin) / distance;
+    }
+
+    void addSegment(Node<T>* start) {
+        order.push_back((int64_t) starts.size());
+        starts.push_back(start);
+        copies.emplace_back();
+        shared.push_back(true);
+        sharedCount++;
+    }
+
+    /**
+     * Builds the Fenwick tree from the current index of the first node at each position
+     * @param indices
+     */
+    void indexSegments(const std::vector<int64_t>& indices) {
+        indexTree.assign(indices.size() + 1, 0);
+        for (size_t i = 1; i < indexTree.size(); i++) {
+            size_t parent = i - (i & -i);
+            indexTree[i] = indices[i - 1] - (parent == 0 ? 0 : indices[parent - 1]);
+        }
+    }
+
+    /**
+     * Builds the Fenwick tree once all segments have been added
+     */
+    void indexSegments() {
+        std::vector<int64_t> indices;
+        indices.reserve(starts.size());
+        for (int64_t segment = 0; segment < (int64_t) starts.size(); segment++)
+            indices.push_back(segmentStart(segment));
+        indexSegments(indices);
+    }
+
+    /**
+     * @param position Position in the order of the list
+     * @return Current index of the first node of the segment at the position
+     */
+    int64_t indexAt(int64_t position) {
+        int64_t index = 0;
+        for (size_t i = (size_t) position + 1; i > 0; i -= i & -i)
+            index += indexTree[i];
+        return index;
+    }
+
+    /**
+     * @param index
+     * @return Position of the last segment whose first node is at or in front of the index, -1 if there is none
+     */
+    int64_t positionAt(int64_t index) {
+        size_t position = 0;
+        int64_t sum = 0;
+        for (size_t step = std::bit_floor(indexTree.size()); step > 0; step >>= 1) {
+            if (position + step < indexTree.size() && sum + indexTree[position + step] <= index) {
+                position += step;
+                sum += indexTree[position];
+            }
+        }
+        return (int64_t) position - 1;
+    }
+
+    /**
+     * Moves all segments whose first node is at or behind the index, after the list has inserted or removed nodes
+     * @param index
+     * @param delta Number of inserted nodes, negative for removed ones
+     */
+    void shift(int64_t index, int64_t delta) {
+        if (sharedCount == 0)
+            return;
+        for (size_t i = (size_t) (positionAt(index - 1) + 2); i < indexTree.size(); i += i & -i)
+            indexTree[i] += delta;
+    }
+
+    /**
+     * Follows a rotation of the list, so that the segments behind the index come first. The segment that
+     * wraps around has to be preserved already.
+     * @param k Index of the new first node
+     * @param listSize
+     */
+    void rotate(int64_t k, int64_t listSize) {
+        if (sharedCount == 0)
+            return;
+        int64_t count = (int64_t) order.size();
+        int64_t cut = positionAt(k - 1) + 1;
+        std::vector<int64_t> indices;
+        std::vector<int64_t> rotated;
+        indices.reserve(count);
+        rotated.reserve(count);
+        for (int64_t i = 0; i < count; i++) {
+            int64_t position = (cut + i) % count;
+            indices.push_back(indexAt(position) + (position >= cut ? -k : listSize - k));
+            rotated.push_back(order[position]);
+        }
+        order = std::move(rotated);
+        indexSegments(indices);
+    }
+
+    /**
+     * Copies the elements of a shared segment, so that the list may modify its nodes afterwards
+     * @param segment
+     */
+    void preserve(int64_t segment) {
+        auto copy = std::make_shared<std::vector<T>>();
+        copy->reserve(segmentLength(segment));
+        std::lock_guard<std::mutex> lock(mutex);
+        for (SliceIterator<T> node(starts[segment], segmentLength(segment)); node != std::default_sentinel; ++node)
+            copy->push_back(*node);
+        copies[segment] = std::move(copy);
+        shared[segment] = false;
+        sharedCount--;
+    }
+
+    /**
+     * Preserves the segment the node at the index belongs to, if any. Nodes added after the snapshot has
+     * been taken belong to no segment.
+     * @param index Current index of the node
+     * @param linkBehind True if only the link behind the node is going to change, which only affects
+     * the segment if the node is not its last one
+     */
+    void preserveIndex(int64_t index, bool linkBehind) {
+        if (sharedCount == 0)
+            return;
+        int64_t position = positionAt(index);
+        if (position == -1)
+            return;
+        int64_t segment = order[position];
+        if (shared[segment] && index - indexAt(position) < segmentLength(segment) - (linkBehind ? 1 : 0))
+            preserve(segment);
+    }
+
+    void preserveAll() {
+        for (int64_t segment = 0; segment < (int64_t) starts.size(); segment++)
+            if (shared[segment])
+                preserve(segment);
+    }
+};
+
+/**
+ * Immutable view of a QuickList at the time QuickList::snapshot was called. Reading a snapshot never
+ * waits for the list's writer for longer than it takes to copy one segment, and may happen on another
+ * thread while the list is modified. The snapshot stays valid after the list has been destroyed.
+ * @tparam T
+ */
+template <typename T>
+class QuickListSnapshot {
+public:
+    std::shared_ptr<SnapshotSegments<T>> segments;
+
+    QuickListSnapshot() = default;
+
+    explicit QuickListSnapshot(std::shared_ptr<SnapshotSegments<T>> snapshotSegments) : segments(std::move(snapshotSegments)) {}
+
+    int64_t getSize() {
+        return segments == nullptr ? 0 : segments->size;
+    }
+
+    /**
+     * Gets the element at the given index in O(√n) by walking from the first node of its segment.
+     * @param index Has to be in range
+     * @return
+     */
+    T get(int64_t index) {
+        if (segments->reversed)
+            index = segments->size - 1 - index;
+        int64_t segment = segments->segmentOf(index);
+        int64_t offset = index - segments->segmentStart(segment);
+
+        std::lock_guard<std::mutex> lock(segments->mutex);
+        if (segments->copies[segment] != nullptr)
+            return (*segments->copies[segment])[offset];
+        Node<T>* node = segments->starts[segment];
+        for (int64_t i = 0; i < offset; i++)
+            node = node->getNextNode();
+        return node->getData();
+    }
+
+    /**
+     * Calls the function with every element in order. Shared segments are copied into a buffer one at a
+     * time, so the list's writer is never held up for longer than one segment.
+     * @tparam F
+     * @param function
+     */
+    template <typename F>
+    void forEach(F function) {
+        std::vector<T> buffer;
+        int64_t segmentCount = segments == nullptr ? 0 : (int64_t) segments->starts.size();
+        for (int64_t i = 0; i < segmentCount; i++) {
+            int64_t segment = segments->reversed ? segmentCount - 1 - i : i;
+            std::shared_ptr<const std::vector<T>> copy;
+            {
+                std::lock_guard<std::mutex> lock(segments->mutex);
+                copy = segments->copies[segment];
+                if (copy == nullptr) {
+                    buffer.clear();
+                    //Never reads the link behind the segment's last node, which the writer may change meanwhile
+                    SliceIterator<T> node(segments->starts[segment], segments->segmentLength(segment));
+                    for (; node != std::default_sentinel; ++node)
+                        buffer.push_back(*node);
+                }
+            }
+            const std::vector<T>& elements = copy != nullptr ? *copy : buffer;
+            if (segments->reversed) {
+                for (auto data = elements.rbegin(); data != elements.rend(); ++data)
+                    function(*data);
+            } else {
+                for (const T& data : elements)
+                    function(data);
+            }
+        }
+    }
+};
 
+/**
+ * Interface of the optional value index of a QuickList, so that QuickList itself does not require a hash
+ * function for T unless the index is enabled.
+ * @tparam T
+ */
 template <typename T>
-class QuickList : public BaseList<T> {
+class ValueIndexBase {
+public:
+    virtual ~ValueIndexBase() = default;
+
+    virtual void insert(Node<T>* node) = 0;
+
+    virtual void erase(Node<T>* node) = 0;
+
+    /**
+     * @param data
+     * @param found Receives all nodes holding the given value, in no particular order
+     */
+    virtual void find(const T& data, std::vector<Node<T>*>& found) = 0;
+
+    /**
+     * @param data
+     * @return Number of nodes holding the given value
+     */
+    virtual size_t count(const T& data) = 0;
+
+    virtual void clear() = 0;
+
+    /**
+     * @return Estimated bytes allocated by the index
+     */
+    virtual size_t memoryUsage() = 0;
+
+    /**
+     * Gives back buckets that are no longer needed for the current number of values
+     */
+    virtual void shrink() = 0;
+};
+
+/**
+ * Maps each value to the nodes that hold it, see QuickList::enableValueIndex.
+ * @tparam T
+ * @tparam Hash
+ */
+template <typename T, typename Hash = std::hash<T>>
+class ValueIndex : public ValueIndexBase<T> {
+public:
+    std::unordered_map<T, std::unordered_set<Node<T>*>, Hash> nodes;
+
+    void insert(Node<T>* node) override {
+        nodes[node->getData()].insert(node);
+    }
+
+    void erase(Node<T>* node) override {
+        auto entry = nodes.find(node->getData());
+        if (entry == nodes.end())
+            return;
+        entry->second.erase(node);
+        if (entry->second.empty())
+            nodes.erase(entry);
+    }
+
+    void find(const T& data, std::vector<Node<T>*>& found) override {
+        found.clear();
+        auto entry = nodes.find(data);
+        if (entry != nodes.end())
+            found.assign(entry->second.begin(), entry->second.end());
+    }
+
+    size_t count(const T& data) override {
+        auto entry = nodes.find(data);
+        return entry == nodes.end() ? 0 : entry->second.size();
+    }
+
+    void clear() override {
+        nodes.clear();
+    }
+
+    /**
+     * Estimates one pointer per bucket and one allocation with two pointers of overhead per entry
+     * @return Estimated bytes allocated by the index
+     */
+    size_t memoryUsage() override {
+        size_t bytes = nodes.bucket_count() * sizeof(void*);
+        for (auto& entry : nodes)
+            bytes += sizeof(entry) + 2 * sizeof(void*) + entry.second.bucket_count() * sizeof(void*) +
+                    entry.second.size() * (sizeof(Node<T>*) + 2 * sizeof(void*));
+        return bytes;
+    }
+
+    void shrink() override {
+        nodes.rehash(0);
+    }
+};
+
+/**
+ * @tparam T
+ * @tparam Allocator Allocator the nodes of the list and of its JumpList are taken from
+ */
+template <typename T, typename Allocator = std::allocator<T>>
+class QuickList : public BaseList<T, Allocator> {
 public:
     /**
      * The TrailingPointer allows for constant time sequential operations. Otherwise, it is used
      * if it is more efficient to iterate the list from its Trailing index than it is to iterate
-     * from head or tail. It does this by saving the search result of the last search operation.
+     * from head or tail. It does this by saving the search result of a previous search operation.
+     * A QuickList keeps several of them as fingers, one per independent access stream.
      */
     typedef struct TrailingPointer {
-        int index;
-        Node<Node<T>*>* jumpPointer;
-        Node<T>* node;
+        int64_t index = -1;
+        Node<Node<T>*>* jumpPointer = nullptr;
+        Node<T>* node = nullptr;
+        //Value of fingerClock at the last use, 0 if invalid
+        uint64_t lastUse = 0;
     } TrailingPointer;
 
     /**
@@ -30,24 +492,344 @@ public:
         searchResult r {nullptr, nullptr};
     } searchCheck;
 
+    /**
+     * Lets the operations of a reversed QuickList work on the physical order of its nodes while it exists.
+     * Positional operations translate their arguments for a reversed QuickList and then call themselves
+     * inside a PhysicalOrder.
+     */
+    class PhysicalOrder {
+    public:
+        explicit PhysicalOrder(QuickList& quickList) : list(quickList) {
+            list.reversed = false;
+        }
+
+        ~PhysicalOrder() {
+            list.reversed = true;
+        }
+
+    private:
+        QuickList& list;
+    };
+
+    /**
+     * JumpList for a new distance that a helper thread builds while the current JumpList keeps serving
+     * searches, see setBackgroundRebuild(). The helper visits the nodes in chunks under the mutex, operations
+     * that relink nodes hold it for their whole duration and move the JumpPointers built so far and the
+     * position of the helper along with the inserted or removed node.
+     */
+    class BackgroundRebuild {
+    public:
+        JumpList<T, Allocator> jumpList;
+        int64_t distance;
+        //Next node to visit and its index. All JumpPointers built so far point to nodes below nextIndex.
+        Node<T>* nextNode;
+        int64_t nextIndex = 0;
+        //Guards the members above and the links of all nodes of the QuickList while the helper runs
+        std::mutex mutex;
+        bool cancelled = false;
+        //Set by the helper once it is finished, read without the mutex
+        std::atomic<bool> done = false;
+        std::thread helper;
+
+        BackgroundRebuild(const Allocator& allocator, int64_t distance, Node<T>* firstNode) :
+        jumpList(allocator), distance(distance), nextNode(firstNode) {}
+
+        /**
+         * Visits nodes and appends a JumpPointer for each one on a position of the new grid
+         * @param tail Tail of the QuickList
+         * @param count Maximum number of nodes to visit
+         * @param reservedOnly True to stop once the slots reserved for JumpPointers are used up,
+         * so that the helper never calls the allocator
+         * @return True if there is nothing left to visit for the helper
+         */
+        bool visit(Node<T>* tail, int64_t count, bool reservedOnly) {
+            for (; count > 0 && nextNode != tail; count--) {
+                if ((nextIndex + 1) % distance == 0) {
+                    if (reservedOnly && jumpList.nodes.freeSlotCount() == 0)
+                        return true;
+                    jumpList.append(nextNode);
+                }
+                nextNode = nextNode->getNextNode();
+                nextIndex++;
+            }
+            return nextNode == tail;
+        }
+
+        /**
+         * @param index
+         * @return The first JumpPointer built so far at or behind the index, the tail if there is none
+         */
+        Node<Node<T>*>* firstJumpPointerBehind(int64_t index) {
+            int64_t ordinal = index / distance;
+            if (ordinal >= jumpList.getSize())
+                return jumpList.getTail();
+            return jumpList.getNode(ordinal);
+        }
+
+        /**
+         * @param index Index of the new node
+         * @param node The new node, already linked
+         */
+        void afterInsert(int64_t index, Node<T>* node) {
+            if (index == nextIndex) {
+                nextNode = node;
+            } else if (index < nextIndex) {
+                //The last visited node moves onto nextIndex and gets visited again
+                jumpList.leftPointerShift(firstJumpPointerBehind(index));
+                nextNode = nextNode->getPrevNode();
+            }
+        }
+
+        /**
+         * @param index Index of the node
+         * @param node The node about to be unlinked
+         */
+        void beforeErase(int64_t index, Node<T>* node) {
+            if (index == nextIndex) {
+                nextNode = node->getNextNode();
+            } else if (index < nextIndex) {
+                jumpList.rightPointerShift(firstJumpPointerBehind(index));
+                nextIndex--;
+                //The last JumpPointer may have moved onto nextNode, which gets visited again
+                if (jumpList.getSize() * distance - 1 >= nextIndex)
+                    jumpList.removeLast();
+            }
+        }
+    };
+
+    /**
+     * Locks a BackgroundRebuild for the duration of an operation that relinks nodes, if there is one
+     */
+    class RebuildGuard {
+    public:
+        explicit RebuildGuard(QuickList& quickList) : rebuild(quickList.pendingRebuild) {
+            if (rebuild != nullptr)
+                lock = std::unique_lock<std::mutex>(rebuild->mutex);
+        }
+
+        void afterInsert(int64_t index, Node<T>* node) {
+            if (rebuild != nullptr)
+                rebuild->afterInsert(index, node);
+        }
+
+        void beforeErase(int64_t index, Node<T>* node) {
+            if (rebuild != nullptr)
+                rebuild->beforeErase(index, node);
+        }
+
+    private:
+        BackgroundRebuild* rebuild;
+        std::unique_lock<std::mutex> lock;
+    };
+
     //JumpList provides the JumpPointers that point to individual nodes in the QuickList for fast access
     //This is the core functionality of a QuickList
-    JumpList<T> jumpList;
+    JumpList<T, Allocator> jumpList;
 
-    //TrailingPointer keeps track of the last used node and jumpPointer
-    //to speed up (semi-)sequential rw operations
-    TrailingPointer trailingPointer = {-1, nullptr, nullptr};
+    //Number of TrailingPointers kept as fingers
+    static constexpr int fingerCount = 4;
+
+    //Fingers keep track of recently used nodes and jumpPointers to speed up (semi-)sequential rw operations,
+    //even if several sequential access streams are interleaved. A search moves the finger it started from,
+    //or replaces the least recently used one if it started from the JumpList head or tail.
+    TrailingPointer fingers[fingerCount];
+    uint64_t fingerClock = 0;
+
+    //Searches that needed the JumpList, and how many of them started from a finger, see fingerHitRate()
+    uint64_t fingerSearches = 0;
+    uint64_t fingerHits = 0;
+
+    //Nodes and JumpPointers stepped over by searches
+    uint64_t searchSteps = 0;
 
     //Distance between individual JumpPointers. Initial: 10
     //Always a multiple of 10, never below 10
     //Example: JumpPointers point to QuickList index 9, 19, 29, 39, 49,...
-    int distance = 10;
+    int64_t distance = 10;
+
+    //Offset of the grid the JumpPointers are placed on. The node at index i sits at grid position
+    //i + origin and JumpPointers point to the nodes at grid positions distance - 1, 2 * distance - 1,...
+    //prepend and removeFirst move the origin instead of every JumpPointer. Always in [0, distance - 1],
+    //reset to 0 by a rebuild.
+    int64_t origin = 0;
+
+    //True if the order of the elements is reversed, see reverse(). Nodes, JumpPointers and fingers keep
+    //the physical order, positional operations translate their indices instead.
+    bool reversed = false;
+
+    //Optional recorder that logs every positional operation into a binary trace
+    TraceRecorder* recorder = nullptr;
+
+    //Optional index from values to their nodes, see enableValueIndex()
+    ValueIndexBase<T>* valueIndex = nullptr;
+
+    //Optional hash of the elements of each segment between two JumpPointers, see enableFingerprints().
+    //Entry k belongs to the segment ending with JumpPointer k, the last entry to the segment behind the last one.
+    std::deque<uint64_t> fingerprints;
+    //Powers of fingerprintBase up to the distance
+    std::vector<uint64_t> fingerprintPowers;
+    //Hash of a single element, nullptr while fingerprints are disabled
+    uint64_t (*fingerprintHash)(const T&) = nullptr;
+
+    //Scratch table of locate(), from the nodes it walked over to their distance from the located node
+    std::vector<std::pair<Node<T>*, int64_t>> locateTable;
+
+    //Segments shared with snapshots that are still alive, see snapshot()
+    std::vector<std::shared_ptr<SnapshotSegments<T>>> snapshots;
+
+    //True if crossing the upper critical size builds the next JumpList on a helper thread, see setBackgroundRebuild()
+    bool backgroundRebuild = false;
+    //JumpList being built on a helper thread, nullptr if there is none
+    BackgroundRebuild* pendingRebuild = nullptr;
+
+    //Smallest size at which a helper thread pays off, below it rebuilds stay synchronous
+    static constexpr int64_t backgroundRebuildMinSize = 1 << 16;
+    //Nodes the helper visits per lock of the mutex, bounds how long an operation waits for it
+    static constexpr int64_t backgroundRebuildChunk = 1024;
 
     QuickList() {
+        linkJumpListSentinels();
+    }
+
+    explicit QuickList(const Allocator& allocator) : BaseList<T, Allocator>(allocator), jumpList(allocator) {
+        linkJumpListSentinels();
+    }
+
+    ~QuickList() {
+        cancelBackgroundRebuild();
+        detachSnapshots();
+        delete valueIndex;
+    }
+
+    /**
+     * Clones the other QuickList in one linear pass. The distance is chosen for the final size up front
+     * and the JumpList is built while the nodes are linked. The TraceRecorder is not copied.
+     * @param other
+     */
+    QuickList(const QuickList& other) :
+    QuickList(std::allocator_traits<Allocator>::select_on_container_copy_construction(other.getAllocator())) {
+        copyBuilt(other);
+    }
+
+    /**
+     * Takes over the nodes and the JumpList of the other QuickList in O(1). The other QuickList is empty afterwards.
+     * @param other
+     */
+    QuickList(QuickList&& other) :
+    BaseList<T, Allocator>(std::move(other)),
+    jumpList(std::move(other.jumpList)),
+    distance(other.distance),
+    origin(other.origin),
+    reversed(other.reversed),
+    recorder(other.recorder),
+    valueIndex(other.valueIndex),
+    fingerprints(std::move(other.fingerprints)),
+    fingerprintPowers(std::move(other.fingerprintPowers)),
+    fingerprintHash(other.fingerprintHash),
+    snapshots(std::move(other.snapshots)),
+    backgroundRebuild(other.backgroundRebuild),
+    pendingRebuild(other.pendingRebuild) {
+        std::copy(other.fingers, other.fingers + fingerCount, fingers);
+        fingerClock = other.fingerClock;
+        //The helper keeps running, as the nodes and sentinels it visits move along with it
+        other.pendingRebuild = nullptr;
+        other.valueIndex = nullptr;
+        other.disableFingerprints();
+        other.linkJumpListSentinels();
+        other.distance = 10;
+        other.origin = 0;
+        other.reversed = false;
+        other.forceInvalidateTrailingPointer();
+        other.recorder = nullptr;
+    }
+
+    QuickList& operator=(const QuickList& other) {
+        if (this != &other) {
+            clear();
+            copyBuilt(other);
+        }
+        return *this;
+    }
+
+    QuickList& operator=(QuickList&& other) {
+        if constexpr (!std::allocator_traits<Allocator>::propagate_on_container_move_assignment::value) {
+            if (this != &other && this->getAllocator() != other.getAllocator()) {
+                *this = other;
+                other.clear();
+                return *this;
+            }
+        }
+        if (this != &other) {
+            BaseList<T, Allocator>::operator=(std::move(other));
+            jumpList = std::move(other.jumpList);
+            std::copy(other.fingers, other.fingers + fingerCount, fingers);
+            fingerClock = other.fingerClock;
+            distance = other.distance;
+            origin = other.origin;
+            reversed = other.reversed;
+            recorder = other.recorder;
+            snapshots = std::move(other.snapshots);
+            delete valueIndex;
+            valueIndex = other.valueIndex;
+            other.valueIndex = nullptr;
+            fingerprints = std::move(other.fingerprints);
+            fingerprintPowers = std::move(other.fingerprintPowers);
+            fingerprintHash = other.fingerprintHash;
+            other.disableFingerprints();
+            backgroundRebuild = other.backgroundRebuild;
+            pendingRebuild = other.pendingRebuild;
+            other.pendingRebuild = nullptr;
+
+            other.linkJumpListSentinels();
+            other.distance = 10;
+            other.origin = 0;
+            other.reversed = false;
+            other.forceInvalidateTrailingPointer();
+            other.recorder = nullptr;
+        }
+        return *this;
+    }
+
+    /**
+     * Lets the head and tail of the JumpList point to the head and tail of the QuickList
+     */
+    void linkJumpListSentinels() {
         jumpList.getHead()->setData(this->getHead());
         jumpList.getTail()->setData(this->getTail());
     }
 
+    /**
+     * Appends copies of all nodes of the other QuickList to this empty QuickList in one pass.
+     * Fingerprints are kept if the other QuickList has them.
+     * @param other
+     */
+    void copyBuilt(const QuickList& other) {
+        distance = calcDistance(other.size);
+        origin = 0;
+        reversed = other.reversed;
+        disableFingerprints();
+        Node<T>* node = other.head->getNextNode();
+        while (node != other.tail) {
+            auto* copy = this->newNode();
+            copy->setData(node->getData());
+            appendBuiltNode(copy);
+            node = node->getNextNode();
+        }
+        if (other.fingerprintHash != nullptr) {
+            fingerprintHash = other.fingerprintHash;
+            rehashFingerprints();
+        }
+    }
+
+    /**
+     * Attaches a TraceRecorder that logs each get/set/add/remove/append/prepend call from now on.
+     * The recorder must already be opened with the current size of this QuickList.
+     * @param traceRecorder nullptr to stop recording
+     */
+    void setRecorder(TraceRecorder* traceRecorder) {
+        recorder = traceRecorder;
+    }
+
     /**
      * Increases the size of the QuickList and automatically rebuilds the JumpList or adds another JumpPointer if necessary
      */
@@ -65,45 +847,59 @@ public:
      */
     void decSize() override {
         this->size--;
-        rebuildJumpList();
-
-        if (losesJumpPointer())
+        if (!rebuildJumpList() && losesJumpPointer())
             removeJumpPointer();
     }
 
     /**
-     * @return True if the QuickList has reached a size dividable by distance at which point it needs another JumpPointer
+     * @return True if the last node sits on a grid position that needs another JumpPointer
      */
     bool getsJumpPointer() {
         return this->getSize() != 0 &&
-        this->getSize() % distance == 0;
+        (origin + this->getSize()) % distance == 0;
     }
 
     /**
-     * @return True if the QuickList subceeds a size dividable by distance at which point it needs to remove the last JumpPointer
+     * @return True if the removed last node sat on a grid position that had a JumpPointer
      */
-    bool losesJumpPointer() {return this->getSize() % distance == distance - 1;}
+    bool losesJumpPointer() {return (origin + this->getSize()) % distance == distance - 1;}
 
     /**
      * Appends a JumpPointer to the JumpList
      */
-    void addJumpPointer() {jumpList.append(this->getLastNode());}
+    void addJumpPointer() {
+        jumpList.append(this->getLastNode());
+        if (fingerprintHash != nullptr)
+            fingerprints.push_back(0);
+    }
 
     /**
-     * Removes the last JumpPointer
+     * Removes the last JumpPointer, whose segment has to be the last one then
      */
-    void removeJumpPointer() {jumpList.removeLast();}
+    void removeJumpPointer() {
+        jumpList.removeLast();
+        if (fingerprintHash != nullptr)
+            fingerprints.pop_back();
+    }
 
-    void concat(QuickList<T>* quickList) {
+    void concat(QuickList* quickList) {
+        if (quickList->reversed) {
+            Node<T>* node = quickList->getLastNode();
+            while (node != quickList->getHead()) {
+                append(node->getData());
+                node = node->getPrevNode();
+            }
+            return;
+        }
         Node<T>* node = quickList->getFirstNode();
         while (node != quickList->getTail()) {
-            this->append(node->getData());
+            append(node->getData());
             node = node->getNextNode();
         }
     }
 
-    void concat(T array[], int arraySize) {
-        for (int i = 0; i < arraySize; i++)
+    void concat(T array[], int64_t arraySize) {
+        for (int64_t i = 0; i < arraySize; i++)
             this->append(array[i]);
     }
 
@@ -111,8 +907,31 @@ public:
      * Calculates the distance by using the QuickList size
      * @return distance value as a multiple of 10
      */
-    int calcDistance() {
-        int x = (int) (-5 + sqrt(pow(5, 2) + this->getSize()));
+    int64_t calcDistance() {return calcDistance(this->getSize());}
+
+    /**
+     * @param n Non-negative
+     * @return The largest integer whose square is not greater than n, exact for all 64-bit values
+     */
+    static int64_t integerSqrt(int64_t n) {
+        if (n < 2)
+            return n;
+        //Compares by division, as squaring the estimate can overflow near the 64-bit maximum
+        auto x = (int64_t) std::sqrt((double) n);
+        while (x > n / x)
+            x--;
+        while (x + 1 <= n / (x + 1))
+            x++;
+        return x;
+    }
+
+    /**
+     * Calculates the distance a QuickList of the given size would use
+     * @param size
+     * @return distance value as a multiple of 10
+     */
+    int64_t calcDistance(int64_t size) {
+        int64_t x = integerSqrt(25 + size) - 5;
         x -= x % 10;
         return x + 10;
     }
@@ -121,276 +940,1304 @@ public:
      * Calculates the upper critical size of the QuickList by using the distance
      * @return upper critical size value
      */
-    int upperCritical() {return pow(distance, 2) + 10 * distance;}
+    int64_t upperCritical() {return distance * distance + 10 * distance;}
 
     /**
      * Calculates the lower critical size of the QuickList by using the distance
      * @return lower critical size value
      */
-    int lowerCritical() {return pow(distance, 2) - 10 * distance - 50;}
+    int64_t lowerCritical() {return distance * distance - 10 * distance - 50;}
 
     /**
      * Attempts to rebuild the JumpList. Succeeds if upper or lower critical size has been reached.
      * @return True if JumpList has been rebuilt
      */
     bool rebuildJumpList() {
+        //The current JumpList keeps serving until the one built in the background is installed
+        if (pendingRebuild != nullptr)
+            return false;
+        if (backgroundRebuild && this->getSize() >= upperCritical() && this->getSize() >= backgroundRebuildMinSize &&
+        fingerprintHash == nullptr) {
+            startBackgroundRebuild();
+            return false;
+        }
         if (this->getSize() >= upperCritical() || this->getSize() <= lowerCritical()) {
-            jumpList.clear();
-            distance = calcDistance();
-            Node<T>* node = this->getFirstNode();
-
-            int index = 1;
-            while (this->hasNext(node)) {
-                if (index % distance == 0)
-                    jumpList.append(node);
-                node = node->getNextNode();
-                index++;
-            }
+            forceRebuildJumpList();
             return true;
         }
         return false;
     }
 
     /**
-     * Updates the values of the TrailingPointer.
-     * The jumpPointer
-     *must be a JumpPointer that points to or below the index.
-     * @param index Last used index
-     * @param node Last used node
-     * @param jumpPointer
-     *Last used jumpPointer
-     *
+     * Rebuilds the JumpList for the current size in one pass, resets the origin and invalidates all fingers
      */
-    void setTrailingPointer(int index, Node<T>* node, Node<Node<T>*>* jumpPointer) {
-        trailingPointer.index = index;
-        trailingPointer.node = node;
-        trailingPointer.jumpPointer= jumpPointer;
+    void forceRebuildJumpList() {
+        cancelBackgroundRebuild();
+        jumpList.clear();
+        distance = calcDistance();
+        origin = 0;
+        forceInvalidateTrailingPointer();
+        jumpList.nodes.reserve((size_t) (this->getSize() / distance));
+        Node<T>* node = this->getFirstNode();
+
+        int64_t index = 1;
+        while (this->hasNext(node)) {
+            if (index % distance == 0)
+                jumpList.append(node);
+            node = node->getNextNode();
+            index++;
+        }
+        if (fingerprintHash != nullptr)
+            rehashFingerprints();
     }
 
     /**
-     * Attempts to invalidate the TrailingPointer. Used when the index/node/jumpPointer
-     *becomes
-     * unavailable due to removal etc. The TrailingPointer is hence only invalidated by this
-     * method if its saved index matches the parameter index.
-     * @param index Determines if the TrailingPointer needs to be invalidated or not
-     * @return True if invalidated
+     * Lets the QuickList build the JumpList for its next distance on a helper thread once it grows past its
+     * upper critical size, instead of rebuilding it in O(n) on the thread that crossed it. The current
+     * JumpList keeps serving searches in the meantime. Operations that relink a single node lock the helper
+     * out for their duration, which waits for at most one chunk of nodes, and move the JumpPointers it has
+     * built so far along with the node in O(√n). The new JumpList is installed in O(1) by the first operation
+     * that starts after the helper is done. Operations that relink many nodes at once, like removeRange,
+     * compact, rotate or insertRange, cancel the helper and rebuild synchronously if needed.
+     * Only used for at least backgroundRebuildMinSize nodes and while fingerprints are disabled.
+     * The QuickList itself still has to be used by one thread at a time.
+     * @param enabled
      */
-    bool invalidateTrailingPointer(int index) {
-        if (trailingPointer.index == index) {
-            trailingPointer.index = -1;
-            trailingPointer.node = nullptr;
-            trailingPointer.jumpPointer= nullptr;
-            return true;
-        }
-        return false;
+    void setBackgroundRebuild(bool enabled) {
+        backgroundRebuild = enabled;
+        if (!enabled)
+            cancelBackgroundRebuild();
     }
 
-    void forceInvalidateTrailingPointer() {
-        trailingPointer.index = -1;
-        trailingPointer.node = nullptr;
-        trailingPointer.jumpPointer= nullptr;
-    }
+    /**
+     * @return True if a helper thread is building the next JumpList
+     */
+    bool isRebuildingInBackground() {
+        return pendingRebuild != nullptr;
+    }
+
+    void startBackgroundRebuild() {
+        int64_t newDistance = calcDistance();
+        pendingRebuild = new BackgroundRebuild(this->getAllocator(), newDistance, this->getFirstNode());
+        //Leaves room for some growth, the helper leaves any JumpPointers beyond it to the installation
+        pendingRebuild->jumpList.nodes.reserve((size_t) ((this->getSize() + this->getSize() / 4) / newDistance + 1));
+        pendingRebuild->helper = std::thread(buildInBackground, pendingRebuild, this->getTail());
+    }
+
+    static void buildInBackground(BackgroundRebuild* rebuild, Node<T>* tail) {
+        bool finished = false;
+        while (!finished) {
+            {
+                std::lock_guard<std::mutex> lock(rebuild->mutex);
+                if (rebuild->cancelled)
+                    return;
+                finished = rebuild->visit(tail, backgroundRebuildChunk, true);
+            }
+            //Lets a waiting operation take the mutex before the next chunk
+            std::this_thread::yield();
+        }
+        rebuild->done.store(true, std::memory_order_release);
+    }
 
     /**
-     * Checks if using the TrailingPointer is viable (the most efficient solution) or not
-     * @param index The searched-for index
-     * @return True if search with TrailingPointer is to be used
+     * Installs the JumpList built in the background if the helper is done. Has to be called while no
+     * RebuildGuard is alive.
      */
-    bool trailingPointerViable(int index) {
-        return
-        trailingPointer.index != -1 &&
-        abs(0 - index) > abs(trailingPointer.index - index) &&
-        abs(this->getMaxIndex() - index) > abs(trailingPointer.index - index);
+    void pollBackgroundRebuild() {
+        if (pendingRebuild != nullptr && pendingRebuild->done.load(std::memory_order_acquire))
+            installBackgroundRebuild();
     }
 
     /**
-     * @return The index of the pointed-to node by the TrailingPointer JumpPointer
+     * Visits the nodes the helper has left, e.g. the ones appended after it was done, and swaps the new
+     * JumpList in. Resets the origin and invalidates all fingers like a rebuild.
      */
-    int getTrailingJumpPointerIndex() {
-        if (!indexHasJumpPointer(trailingPointer.index))
-            return ((trailingPointer.index - trailingPointer.index % distance) / distance) - 1;
-        else
-            return (((trailingPointer.index + 1) - (trailingPointer.index + 1) % distance) / distance) - 1;
+    void installBackgroundRebuild() {
+        BackgroundRebuild* rebuild = pendingRebuild;
+        pendingRebuild = nullptr;
+        rebuild->helper.join();
+        rebuild->visit(this->getTail(), this->getSize(), false);
+        jumpList = std::move(rebuild->jumpList);
+        linkJumpListSentinels();
+        distance = rebuild->distance;
+        origin = 0;
+        forceInvalidateTrailingPointer();
+        delete rebuild;
+        //The size may have left the range of the new distance while the helper was running
+        rebuildJumpList();
     }
 
     /**
-     * @param index The searched-for index
-     * @return JumpList(!) offset for the TrailingPointer JumpPointer
+     * Stops the helper and discards the JumpList it has built so far
      */
-    int trailingJumpPointerOffset(int index) {return (index + 1) / distance - (trailingPointer.index + 1) / distance;}
+    void cancelBackgroundRebuild() {
+        if (pendingRebuild == nullptr)
+            return;
+        {
+            std::lock_guard<std::mutex> lock(pendingRebuild->mutex);
+            pendingRebuild->cancelled = true;
+        }
+        pendingRebuild->helper.join();
+        delete pendingRebuild;
+        pendingRebuild = nullptr;
+    }
+
+    /**
+     * Removes all nodes and JumpPointers and resets the distance
+     */
+    void clear() override {
+        if (recorder != nullptr)
+            recorder->record(TraceRecorder::CLEAR, 0);
+        cancelBackgroundRebuild();
+        detachSnapshots();
+        if (valueIndex != nullptr)
+            valueIndex->clear();
+        BaseList<T, Allocator>::clear();
+        jumpList.clear();
+        distance = 10;
+        origin = 0;
+        forceInvalidateTrailingPointer();
+        if (fingerprintHash != nullptr)
+            rehashFingerprints();
+    }
+
+    /**
+     * Takes an immutable snapshot in O(√n) that shares all nodes with this QuickList. Only the segments
+     * between two JumpPointers that are modified afterwards are copied, right before their first
+     * modification, so the memory overhead grows with the modified data only.
+     * @return The snapshot
+     */
+    QuickListSnapshot<T> snapshot() {
+        auto segments = std::make_shared<SnapshotSegments<T>>(this->getSize(), distance, origin, reversed);
+        if (!this->isEmpty()) {
+            segments->addSegment(this->getFirstNode());
+            Node<Node<T>*>* jumpPointer = jumpList.getFirstNode();
+            while (jumpList.hasNext(jumpPointer)) {
+                if (jumpPointer->getData()->getNextNode() != this->getTail())
+                    segments->addSegment(jumpPointer->getData()->getNextNode());
+                jumpPointer = jumpPointer->getNextNode();
+            }
+            segments->indexSegments();
+        }
+        snapshots.push_back(segments);
+        return QuickListSnapshot<T>(segments);
+    }
+
+    /**
+     * Lets all snapshots copy the segment of a node that is about to be modified and forgets about
+     * snapshots that no longer exist or no longer share any segment.
+     * @param index Physical index of the node
+     * @param linkBehind True if only the link behind the node is going to change
+     */
+    void preserveForSnapshots(int64_t index, bool linkBehind) {
+        for (size_t i = 0; i < snapshots.size(); i++) {
+            if (snapshots[i].use_count() > 1)
+                snapshots[i]->preserveIndex(index, linkBehind);
+            if (snapshots[i].use_count() == 1 || snapshots[i]->sharedCount == 0) {
+                snapshots[i] = std::move(snapshots.back());
+                snapshots.pop_back();
+                i--;
+            }
+        }
+    }
+
+    /**
+     * Moves the segments of all snapshots behind nodes that have been inserted or removed
+     * @param index Physical index of the first node behind the inserted ones, or of the removed node
+     * @param delta Number of inserted nodes, negative for removed ones
+     */
+    void shiftSnapshots(int64_t index, int64_t delta) {
+        for (auto& segments : snapshots)
+            segments->shift(delta < 0 ? index - delta : index, delta);
+    }
+
+    /**
+     * Copies everything the snapshots still share, before an operation that touches all nodes
+     */
+    void detachSnapshots() {
+        for (auto& segments : snapshots)
+            if (segments.use_count() > 1)
+                segments->preserveAll();
+        snapshots.clear();
+    }
+
+    /**
+     * Starts maintaining an index from each value to the nodes holding it, which turns indexOf and the
+     * removal of occurrences from linear scans into O(√n) per occurrence. Values with more than n / distance
+     * occurrences are still scanned for. Costs one hash map entry per
+     * node and a hash lookup on every insert, remove and set. The index is not copied along with the QuickList.
+     * @tparam Hash Hash function for T
+     */
+    template <typename Hash = std::hash<T>>
+    void enableValueIndex() {
+        delete valueIndex;
+        valueIndex = new ValueIndex<T, Hash>;
+        rebuildValueIndex();
+    }
+
+    void disableValueIndex() {
+        delete valueIndex;
+        valueIndex = nullptr;
+    }
+
+    bool hasValueIndex() {
+        return valueIndex != nullptr;
+    }
+
+    void rebuildValueIndex() {
+        if (valueIndex == nullptr)
+            return;
+        valueIndex->clear();
+        Node<T>* node = this->getFirstNode();
+        while (this->hasNext(node)) {
+            valueIndex->insert(node);
+            node = node->getNextNode();
+        }
+    }
+
+    /**
+     * Checks whether the occurrences of a value are few enough to be located one by one. Each of them
+     * costs O(√n) to locate, so beyond n / distance occurrences a linear scan is at least as fast.
+     * @param data
+     * @return True if the value index should be used for the value
+     */
+    bool fewOccurrences(const T& data) {
+        return valueIndex != nullptr && (int64_t) valueIndex->count(data) <= this->getSize() / distance;
+    }
+
+    /**
+     * Locates the occurrences of a value and orders them only as far as needed to find the nth one
+     * @param data
+     * @param n Zero-based rank of the occurrence by index
+     * @param fromBack Whether to rank the occurrences from the back
+     * @return The node of the occurrence, nullptr if there are not enough occurrences
+     */
+    Node<T>* nthOccurrence(const T& data, int64_t n, bool fromBack) {
+        std::vector<Node<T>*> nodes;
+        valueIndex->find(data, nodes);
+        if (n < 0 || n >= (int64_t) nodes.size())
+            return nullptr;
+        std::vector<std::pair<int64_t, Node<T>*>> occurrences;
+        occurrences.reserve(nodes.size());
+        Node<Node<T>*>* jumpPointer;
+        for (Node<T>* node : nodes)
+            occurrences.emplace_back(locate(node, jumpPointer), node);
+        auto nth = occurrences.begin() + (fromBack ? (int64_t) occurrences.size() - 1 - n : n);
+        std::nth_element(occurrences.begin(), nth, occurrences.end());
+        return nth->second;
+    }
+
+    /**
+     * Locates the occurrences of a value and keeps the lowest or highest index among them
+     * @param data
+     * @param last Whether to keep the highest index
+     * @return The index, -1 if there is no occurrence
+     */
+    int64_t boundaryOccurrence(const T& data, bool last) {
+        std::vector<Node<T>*> nodes;
+        valueIndex->find(data, nodes);
+        int64_t best = -1;
+        Node<Node<T>*>* jumpPointer;
+        for (Node<T>* node : nodes) {
+            int64_t index = locate(node, jumpPointer);
+            if (best == -1 || (last ? index > best : index < best))
+                best = index;
+        }
+        return best;
+    }
+
+    int64_t indexOf(T data) {
+        if (reversed) {
+            PhysicalOrder physical(*this);
+            return mirrorIndex(lastIndexOf(data));
+        }
+        if (!fewOccurrences(data))
+            return BaseList<T, Allocator>::indexOf(data);
+        return boundaryOccurrence(data, false);
+    }
+
+    int64_t lastIndexOf(T data) {
+        if (reversed) {
+            PhysicalOrder physical(*this);
+            return mirrorIndex(indexOf(data));
+        }
+        if (!fewOccurrences(data))
+            return BaseList<T, Allocator>::lastIndexOf(data);
+        return boundaryOccurrence(data, true);
+    }
+
+    void removeFirstOccurrence(T data) {
+        removeNthOccurrenceFromFront(data, 1);
+    }
+
+    void removeLastOccurrence(T data) {
+        removeNthOccurrenceFromBack(data, 1);
+    }
+
+    bool removeNthOccurrenceFromFront(T data, int64_t n) {
+        if (reversed) {
+            PhysicalOrder physical(*this);
+            return removeNthOccurrenceFromBack(data, n);
+        }
+        if (!fewOccurrences(data))
+            return BaseList<T, Allocator>::removeNthOccurrenceFromFront(data, n);
+        Node<T>* node = nthOccurrence(data, n - 1, false);
+        return node != nullptr && eraseAt(node) != nullptr;
+    }
+
+    bool removeNthOccurrenceFromBack(T data, int64_t n) {
+        if (reversed) {
+            PhysicalOrder physical(*this);
+            return removeNthOccurrenceFromFront(data, n);
+        }
+        if (!fewOccurrences(data))
+            return BaseList<T, Allocator>::removeNthOccurrenceFromBack(data, n);
+        Node<T>* node = nthOccurrence(data, n - 1, true);
+        return node != nullptr && eraseAt(node) != nullptr;
+    }
+
+    /**
+     * Removes every node holding the value. With the value index and few occurrences the nodes are taken
+     * from the index instead of scanning the list, otherwise a single removeIf pass removes them.
+     * @param data
+     * @return True if at least one node has been removed
+     */
+    bool removeAllOccurrences(T data) {
+        if (!fewOccurrences(data))
+            return removeIf([&data](const T& x) { return x == data; }) > 0;
+        std::vector<Node<T>*> nodes;
+        valueIndex->find(data, nodes);
+        for (Node<T>* node : nodes)
+            eraseAt(node);
+        return !nodes.empty();
+    }
+
+    //Odd, so that it has an inverse modulo 2^64
+    static constexpr uint64_t fingerprintBase = 0x9E3779B97F4A7C15ull;
+    static constexpr uint64_t fingerprintBaseInverse = [] {
+        uint64_t inverse = fingerprintBase;
+        for (int i = 0; i < 6; i++)
+            inverse *= 2 - fingerprintBase * inverse;
+        return inverse;
+    }();
+
+    /**
+     * Keeps a rolling hash of every segment between two JumpPointers from now on. Maintaining them costs
+     * O(1) for append, prepend, set, removeFirst and removeLast. An insert or removal in the middle rehashes
+     * its own segment and updates every segment behind it in O(1), like it shifts their JumpPointers.
+     * Operations that rebuild the JumpList rehash all segments. Writes through node handles are not tracked.
+     * @tparam Hash Has to map equal values to equal hashes, also in other QuickLists that are compared with this one
+     */
+    template <typename Hash = std::hash<T>>
+    void enableFingerprints() {
+        fingerprintHash = [](const T& data) -> uint64_t {
+            //Step of splitmix64, spreads weak hashes like the identity hash of integers. The added constant keeps 0 from hashing to 0.
+            uint64_t x = (uint64_t) Hash{}(data) + 0x9E3779B97F4A7C15ull;
+            x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+            x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+            return x ^ (x >> 31);
+        };
+        //Fingerprints follow the distance, which the installation of a background rebuild would change
+        cancelBackgroundRebuild();
+        rehashFingerprints();
+    }
+
+    void disableFingerprints() {
+        fingerprintHash = nullptr;
+        fingerprints.clear();
+        fingerprintPowers.clear();
+    }
+
+    bool hasFingerprints() {
+        return fingerprintHash != nullptr;
+    }
 
     /**
-     * Scenario: JumpPointers point to indices 119, 139, 159, and you want to get the nearest index of the node
-     * that is pointed to by a JumpPointer. Input index is 155. This method will return 139 then (It is always
-     * the previous node that is returned, never the next, even if the next one is nearer, like in this case).
-     * If the input index is equal to the index of a node pointed to by a JumpPointer, that same index is
-     * returned, e.g. 139 if your input is 139 in the above example.
      * @param index
-     * @return The index of the node that is pointed to by a JumpPointer
+     * @return The segment the index lies in, i.e. the number of JumpPointers in front of it
+     */
+    int64_t segmentOf(int64_t index) {
+        return getJumpOrdinal(index - 1) + 1;
+    }
+
+    /**
+     * @param segment
+     * @return Number of nodes in the segment, which is the distance for all but the first and the last one
+     */
+    int64_t segmentLength(int64_t segment) {
+        return std::min(getJumpOrdinalIndex(segment), this->getMaxIndex()) - getJumpOrdinalIndex(segment - 1);
+    }
+
+    /**
+     * Walks the JumpList from its nearer end
+     * @param segment
+     * @return The first node of the segment, the tail if it is empty
+     */
+    Node<T>* segmentStart(int64_t segment) {
+        Node<Node<T>*>* jumpPointer = jumpList.getHead();
+        if (segment <= jumpList.getSize() - segment) {
+            for (int64_t i = 0; i < segment; i++)
+                jumpPointer = jumpPointer->getNextNode();
+        } else {
+            jumpPointer = jumpList.getTail();
+            for (int64_t i = jumpList.getSize(); i >= segment; i--)
+                jumpPointer = jumpPointer->getPrevNode();
+        }
+        return jumpPointer->getData()->getNextNode();
+    }
+
+    /**
+     * Recomputes the powers for the current distance and the fingerprints of all segments in one pass
+     */
+    void rehashFingerprints() {
+        fingerprintPowers.resize(distance + 1);
+        fingerprintPowers[0] = 1;
+        for (int64_t i = 1; i <= distance; i++)
+            fingerprintPowers[i] = fingerprintPowers[i - 1] * fingerprintBase;
+        fingerprints.assign(jumpList.getSize() + 1, 0);
+        rehashSegments(0, jumpList.getSize());
+    }
+
+    /**
+     * Recomputes the fingerprints of consecutive segments
+     * @param first
+     * @param last Inclusive, at most the size of the JumpList
+     */
+    void rehashSegments(int64_t first, int64_t last) {
+        Node<T>* node = segmentStart(first);
+        for (int64_t segment = first; segment <= last; segment++) {
+            uint64_t hash = 0;
+            for (int64_t i = segmentLength(segment); i > 0; i--, node = node->getNextNode())
+                hash = hash * fingerprintBase + fingerprintHash(node->data);
+            fingerprints[segment] = hash;
+        }
+    }
+
+    /**
+     * Updates the fingerprints for a node that is about to be linked in front of nextNode, before anything is
+     * shifted. The segment of the index is rehashed. Every segment behind it loses its last node to the next
+     * segment and receives the last node of the previous one, just like its JumpPointer is shifted.
+     * @param index The index of nextNode, 0 < index < size
+     * @param nextNode
+     * @param shifted The first JumpPointer at or behind the index
+     * @param data
+     */
+    void insertIntoFingerprints(int64_t index, Node<T>* nextNode, Node<Node<T>*>* shifted, const T& data) {
+        int64_t segment = segmentOf(index);
+        int64_t last = jumpList.getSize();
+        uint64_t hash = 0;
+        Node<T>* node = shifted->getPrevNode()->getData()->getNextNode();
+        bool inserted = false;
+        for (int64_t i = segmentLength(segment) + (segment == last ? 1 : 0); i > 0; i--) {
+            if (node == nextNode && !inserted) {
+                hash = hash * fingerprintBase + fingerprintHash(data);
+                inserted = true;
+            } else {
+                hash = hash * fingerprintBase + fingerprintHash(node->data);
+                node = node->getNextNode();
+            }
+        }
+        fingerprints[segment] = hash;
+
+        if (shifted == jumpList.getTail())
+            return;
+        uint64_t incoming = fingerprintHash(shifted->getData()->data);
+        for (int64_t k = segment + 1; k <= last; k++) {
+            shifted = shifted->getNextNode();
+            int64_t length = distance;
+            uint64_t outgoing = 0;
+            if (k < last) {
+                outgoing = fingerprintHash(shifted->getData()->data);
+                fingerprints[k] = (fingerprints[k] - outgoing) * fingerprintBaseInverse;
+                length--;
+            } else {
+                length = segmentLength(k);
+            }
+            fingerprints[k] += incoming * fingerprintPowers[length];
+            incoming = outgoing;
+        }
+    }
+
+    /**
+     * Updates the fingerprints for a node that is about to be removed, before anything is shifted. The segment
+     * of the index is rehashed. Every segment behind it loses its first node to the previous segment and receives
+     * the first node of the next one, just like its JumpPointer is shifted.
+     * @param index The index of the node, 0 < index < maxIndex
+     * @param node
+     * @param shifted The first JumpPointer at or behind the index
+     */
+    void eraseFromFingerprints(int64_t index, Node<T>* node, Node<Node<T>*>* shifted) {
+        int64_t segment = segmentOf(index);
+        int64_t last = jumpList.getSize();
+        uint64_t hash = 0;
+        Node<T>* current = shifted->getPrevNode()->getData()->getNextNode();
+        for (int64_t i = segmentLength(segment); i > 0; i--, current = current->getNextNode()) {
+            if (current == node)
+                current = current->getNextNode();
+            if (current == this->getTail())
+                break;
+            hash = hash * fingerprintBase + fingerprintHash(current->data);
+        }
+        fingerprints[segment] = hash;
+
+        if (shifted == jumpList.getTail())
+            return;
+        Node<T>* first = shifted->getData()->getNextNode();
+        uint64_t outgoing = first != this->getTail() ? fingerprintHash(first->data) : 0;
+        for (int64_t k = segment + 1; k <= last && first != this->getTail(); k++) {
+            shifted = shifted->getNextNode();
+            fingerprints[k] -= outgoing * fingerprintPowers[(k < last ? distance : segmentLength(k)) - 1];
+            if (k == last)
+                break;
+            first = shifted->getData()->getNextNode();
+            outgoing = first != this->getTail() ? fingerprintHash(first->data) : 0;
+            if (first != this->getTail())
+                fingerprints[k] = fingerprints[k] * fingerprintBase + outgoing;
+        }
+    }
+
+    /**
+     * @param other
+     * @return True if both QuickLists keep fingerprints with the same hash on the same grid in physical order,
+     * so that their segments cover the same indices
+     */
+    bool fingerprintsComparable(QuickList& other) {
+        return fingerprintHash != nullptr && fingerprintHash == other.fingerprintHash &&
+        distance == other.distance && origin == other.origin && !reversed && !other.reversed;
+    }
+
+    /**
+     * Compares the elements in order. If both QuickLists keep comparable fingerprints, only their
+     * O(√n) fingerprints are compared, which takes two different segments with equal fingerprints for
+     * equal, with a chance of about 2^-64 per segment.
+     * @param other
+     * @return True if both hold equal elements in the same order
+     */
+    bool operator==(QuickList& other) {
+        if (this->getSize() != other.getSize())
+            return false;
+        if (fingerprintsComparable(other))
+            return fingerprints == other.fingerprints;
+        return firstDifference(other) == -1;
+    }
+
+    /**
+     * Finds where two QuickLists diverge. If both keep comparable fingerprints, segments with equal fingerprints
+     * are skipped by walking the JumpLists, and elements are only compared from the first segment that differs,
+     * which costs O(√n) instead of O(n).
+     * @param other
+     * @return The first index whose elements differ, the size of the shorter QuickList if it is a prefix
+     * of the other one, -1 if both are equal
+     */
+    int64_t firstDifference(QuickList& other) {
+        Node<T>* node = reversed ? this->getLastNode() : this->getFirstNode();
+        Node<T>* otherNode = other.reversed ? other.getLastNode() : other.getFirstNode();
+        int64_t index = 0;
+
+        if (fingerprintsComparable(other)) {
+            Node<Node<T>*>* jumpPointer = jumpList.getFirstNode();
+            Node<Node<T>*>* otherJumpPointer = other.jumpList.getFirstNode();
+            for (int64_t segment = 0; jumpPointer != jumpList.getTail() && otherJumpPointer != other.jumpList.getTail() &&
+            fingerprints[segment] == other.fingerprints[segment]; segment++) {
+                node = jumpPointer->getData()->getNextNode();
+                otherNode = otherJumpPointer->getData()->getNextNode();
+                index = getJumpOrdinalIndex(segment) + 1;
+                jumpPointer = jumpPointer->getNextNode();
+                otherJumpPointer = otherJumpPointer->getNextNode();
+            }
+        }
+
+        Node<T>* end = reversed ? this->getHead() : this->getTail();
+        Node<T>* otherEnd = other.reversed ? other.getHead() : other.getTail();
+        for (; node != end && otherNode != otherEnd; index++) {
+            if (!(node->data == otherNode->data))
+                return index;
+            node = reversed ? node->getPrevNode() : node->getNextNode();
+            otherNode = other.reversed ? otherNode->getPrevNode() : otherNode->getNextNode();
+        }
+        return node == end && otherNode == otherEnd ? -1 : index;
+    }
+
+    /**
+     * Removes all nodes whose data satisfies the predicate in a single pass and repairs the JumpList
+     * afterwards with one linear rebuild, instead of maintaining it for every removed node.
+     * @tparam Predicate
+     * @param predicate Called once per node; has to be safe to call concurrently if threads > 1
+     * @param threads Number of threads evaluating the predicate, each on its own range of segments
+     * between JumpPointers. Unlinking and freeing always happens on the calling thread.
+     * @return The number of removed nodes
      */
-    int getJumpIndex(int index) {
-        if (indexHasJumpPointer(index))
-            return index;
+    template <typename Predicate>
+    int64_t removeIf(Predicate predicate, int threads = 1) {
+        if (this->isEmpty())
+            return 0;
+        cancelBackgroundRebuild();
+        detachSnapshots();
+
+        std::vector<char> matches(this->getSize());
+        threads = (int) std::clamp<int64_t>(threads, 1, jumpList.getSize() + 1);
+        if (threads == 1) {
+            markMatches(predicate, this->getFirstNode(), 0, this->getSize(), matches);
+        } else {
+            //Each thread starts behind a JumpPointer, chosen so that the ranges are about equally long
+            std::vector<Node<T>*> starts {this->getFirstNode()};
+            std::vector<int64_t> startIndices {0};
+            Node<Node<T>*>* jumpPointer = jumpList.getFirstNode();
+            for (int64_t ordinal = 0; jumpList.hasNext(jumpPointer); ordinal++, jumpPointer = jumpPointer->getNextNode()) {
+                if ((int64_t) (ordinal + 1) * threads / (jumpList.getSize() + 1) == (int64_t) ordinal * threads / (jumpList.getSize() + 1))
+                    continue;
+                int64_t index = getJumpOrdinalIndex(ordinal) + 1;
+                if (index < this->getSize()) {
+                    starts.push_back(jumpPointer->getData()->getNextNode());
+                    startIndices.push_back(index);
+                }
+            }
+            startIndices.push_back(this->getSize());
+
+            std::vector<std::thread> workers;
+            for (size_t i = 1; i < starts.size(); i++)
+                workers.emplace_back([&, i]() {
+                    markMatches(predicate, starts[i], startIndices[i], startIndices[i + 1], matches);
+                });
+            markMatches(predicate, starts[0], startIndices[0], startIndices[1], matches);
+            for (std::thread& worker : workers)
+                worker.join();
+        }
+
+        int64_t removed = 0;
+        Node<T>* node = this->getFirstNode();
+        for (int64_t i = 0; i < (int64_t) matches.size(); i++) {
+            Node<T>* next = node->getNextNode();
+            if (matches[i]) {
+                if (recorder != nullptr)
+                    recorder->record(TraceRecorder::REMOVE, i - removed);
+                if (valueIndex != nullptr)
+                    valueIndex->erase(node);
+                node->getPrevNode()->setNextNode(next);
+                next->setPrevNode(node->getPrevNode());
+                this->deleteNode(node);
+                removed++;
+            }
+            node = next;
+        }
+
+        this->size -= removed;
+        if (removed > 0)
+            forceRebuildJumpList();
+        return removed;
+    }
+
+    /**
+     * Evaluates the predicate for the nodes of one range
+     * @param start First node of the range
+     * @param startIndex Index of the first node
+     * @param endIndex Index behind the last node
+     * @param matches Receives 1 for each node that satisfies the predicate
+     */
+    template <typename Predicate>
+    void markMatches(Predicate& predicate, Node<T>* start, int64_t startIndex, int64_t endIndex, std::vector<char>& matches) {
+        for (int64_t i = startIndex; i < endIndex; i++, start = start->getNextNode())
+            matches[i] = predicate(start->getData()) ? 1 : 0;
+    }
+
+    /**
+     * Copies the elements in [start, end) into a contiguous buffer. Locating the start costs a single QuickSearch,
+     * copying walks the range once.
+     * @param start Index of the first element, clamped to 0
+     * @param end Index behind the last element, clamped to the size
+     * @param out Has to have room for end - start elements
+     * @param threads Number of threads copying, each on its own part of the range beginning at a JumpPointer
+     * @return The number of copied elements
+     */
+    int64_t copyRange(int64_t start, int64_t end, T* out, int threads = 1) {
+        start = std::max<int64_t>(start, 0);
+        end = std::min(end, this->getSize());
+        if (start >= end)
+            return 0;
+        if (reversed)
+            copyPhysicalRange(mirrorIndex(end - 1), end - start, out, threads, true);
         else
-            return (index - index % distance) - 1;
+            copyPhysicalRange(start, end - start, out, threads, false);
+        return end - start;
+    }
+
+    /**
+     * Copies the first elements into a contiguous buffer
+     * @param out Receives as many elements as fit into it
+     * @param threads Number of threads copying
+     * @return The number of copied elements
+     */
+    int64_t copyTo(std::span<T> out, int threads = 1) {
+        return copyRange(0, (int64_t) out.size(), out.data(), threads);
     }
 
+    /**
+     * @param threads Number of threads copying
+     * @return All elements in a vector
+     */
+    std::vector<T> toVector(int threads = 1) {
+        std::vector<T> elements(this->getSize());
+        copyRange(0, this->getSize(), elements.data(), threads);
+        return elements;
+    }
+
+    /**
+     * Replaces the contents of this QuickList with the given elements. The distance is chosen for the final
+     * size up front, so the nodes and JumpPointers are built in a single pass without any rebuild.
+     * @param elements
+     */
+    void assign(std::span<const T> elements) {
+        clear();
+        reversed = false;
+        distance = calcDistance((int64_t) elements.size());
+        for (const T& element : elements) {
+            auto* node = this->newNode();
+            node->setData(element);
+            appendBuiltNode(node);
+        }
+        if (fingerprintHash != nullptr)
+            rehashFingerprints();
+    }
+
+    /**
+     * Copies count elements beginning at a physical index. A range copied by several threads is split at the
+     * JumpPointers inside it into about equally long parts, which are found by walking the JumpList only.
+     * @param start Physical index of the first element
+     * @param count Number of elements, start + count must not exceed the size
+     * @param out
+     * @param threads
+     * @param backwards True to fill out from its back, used while the QuickList is reversed
+     */
+    void copyPhysicalRange(int64_t start, int64_t count, T* out, int threads, bool backwards) {
+        searchResult r = search(start);
+        threads = (int) std::clamp<int64_t>(threads, 1, jumpList.getSize() + 1);
+        std::vector<Node<T>*> starts {r.node};
+        std::vector<int64_t> offsets {0};
+
+        if (threads > 1) {
+            int64_t partLength = count / threads;
+            Node<Node<T>*>* jumpPointer = r.jumpPointer->getNextNode();
+            for (int64_t ordinal = getJumpOrdinal(start) + 1; jumpList.hasNext(jumpPointer) &&
+            (int64_t) starts.size() < threads; ordinal++, jumpPointer = jumpPointer->getNextNode()) {
+                int64_t offset = getJumpOrdinalIndex(ordinal) - start;
+                if (offset >= count)
+                    break;
+                if (offset >= (int64_t) starts.size() * partLength) {
+                    starts.push_back(jumpPointer->getData());
+                    offsets.push_back(offset);
+                }
+            }
+        }
+        offsets.push_back(count);
+
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < starts.size(); i++)
+            workers.emplace_back([&, i]() {
+                copyRun(starts[i], offsets[i], offsets[i + 1], backwards ? out + count - 1 : out, backwards);
+            });
+        copyRun(starts[0], offsets[0], offsets[1], backwards ? out + count - 1 : out, backwards);
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    /**
+     * Copies the elements of one part of a range
+     * @param node Node of the first element of the part
+     * @param from Offset of the part within the range
+     * @param to Offset behind the part
+     * @param out Position of the range's first element within the buffer
+     * @param backwards True if the buffer is filled downwards from out
+     */
+    void copyRun(Node<T>* node, int64_t from, int64_t to, T* out, bool backwards) {
+        if (backwards) {
+            for (int64_t i = from; i < to; i++, node = node->getNextNode())
+                *(out - i) = node->data;
+        } else {
+            for (int64_t i = from; i < to; i++, node = node->getNextNode())
+                out[i] = node->data;
+        }
+    }
+
+    /**
+     * Bytes allocated by a QuickList, split by what they are used for
+     */
+    typedef struct MemoryUsage {
+        //Nodes holding elements, their sentinels and the block bookkeeping of their pool
+        size_t dataNodeBytes;
+        //JumpPointers, their sentinels and the block bookkeeping of their pool
+        size_t jumpIndexBytes;
+        //Slots of both pools that are allocated but not used by any node
+        size_t pooledFreeBytes;
+        //Estimate for the value index, 0 if it is disabled
+        size_t valueIndexBytes;
+        //The QuickList object itself
+        size_t objectBytes;
+
+        size_t total() const {
+            return dataNodeBytes + jumpIndexBytes + pooledFreeBytes + valueIndexBytes + objectBytes;
+        }
+    } MemoryUsage;
+
+    /**
+     * Costs O(number of pool blocks), plus O(number of distinct values) if the value index is enabled.
+     * Nodes copied for snapshots belong to the snapshots and are not counted.
+     * @return The bytes allocated by this QuickList
+     */
+    MemoryUsage memoryUsage() {
+        return {
+            this->nodeBytes(),
+            jumpList.nodeBytes(),
+            this->freeNodeBytes() + jumpList.freeNodeBytes(),
+            valueIndex != nullptr ? valueIndex->memoryUsage() : 0,
+            sizeof(*this)
+        };
+    }
+
+    /**
+     * Gives pooled slots that no node is using back to the allocator, e.g. after removing most elements.
+     * Moves the nodes into one block of exactly the right size with compact(), which also makes their order
+     * in memory match the list order again, and does nothing if there are no free slots.
+     * Node handles and slices of this QuickList become invalid if anything has been shrunk.
+     * @return The number of bytes given back
+     */
+    size_t shrinkToFit() {
+        if (this->freeNodeBytes() == 0 && jumpList.freeNodeBytes() == 0)
+            return 0;
+        size_t before = memoryUsage().total();
+        compact();
+        if (valueIndex != nullptr)
+            valueIndex->shrink();
+        size_t after = memoryUsage().total();
+        return before > after ? before - after : 0;
+    }
+
+    /**
+     * Relinks the nodes into list order in memory and rebuilds the JumpList on top of them.
+     * Node handles and slices of this QuickList become invalid.
+     */
+    void compact() override {
+        cancelBackgroundRebuild();
+        detachSnapshots();
+        BaseList<T, Allocator>::compact();
+        forceRebuildJumpList();
+        rebuildValueIndex();
+    }
+
+    /**
+     * Links the node behind the last node and appends a JumpPointer if it needs one, without checking
+     * the critical sizes. Used to build a QuickList in a single pass after its distance has already been
+     * chosen for the final size.
+     * @param node
+     */
+    void appendBuiltNode(Node<T>* node) {
+        if (recorder != nullptr)
+            recorder->record(TraceRecorder::APPEND, this->getSize());
+        node->setPrevNode(this->getLastNode());
+        node->setNextNode(this->getTail());
+        node->setNextOfPrev(node);
+        this->getTail()->setPrevNode(node);
+        this->size++;
+        if (valueIndex != nullptr)
+            valueIndex->insert(node);
+
+        if (getsJumpPointer())
+            addJumpPointer();
+    }
+
+    static constexpr char snapshotMagic[4] = {'Q', 'L', 'S', 'N'};
+    static constexpr uint8_t snapshotVersion = 1;
+
+    /**
+     * Snapshot header. Element size is 0 if the elements were written by a non-raw Serializer.
+     * Snapshots use the native byte order.
+     */
+    typedef struct SnapshotHeader {
+        char magic[4];
+        uint8_t version;
+        uint8_t padding[3];
+        uint32_t elementSize;
+        int64_t size;
+    } SnapshotHeader;
+
+    /**
+     * Writes a binary snapshot of this QuickList that can be restored by loadFrom.
+     * @tparam S Serializer used for the elements; the default one requires a trivially copyable T
+     * @param out
+     * @return True if the whole snapshot has been written
+     */
+    template <typename S = Serializer<T>>
+    bool saveTo(std::ostream& out) {
+        constexpr bool raw = requires { requires S::rawBytes; };
+        SnapshotHeader header {{}, snapshotVersion, {}, raw ? (uint32_t) sizeof(T) : 0, this->getSize()};
+        std::copy(snapshotMagic, snapshotMagic + 4, header.magic);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        //A reversed QuickList is written in its reversed order
+        Node<T>* node = reversed ? this->getLastNode() : this->getFirstNode();
+        Node<T>* end = reversed ? this->getHead() : this->getTail();
+        if constexpr (raw) {
+            //Elements are gathered into blocks to keep the amount of stream calls low
+            constexpr int blockSize = 4096;
+            T* block = new T[blockSize];
+            int64_t count = 0;
+            while (node != end) {
+                block[count++] = node->getData();
+                node = reversed ? node->getPrevNode() : node->getNextNode();
+                if (count == blockSize || node == end) {
+                    out.write(reinterpret_cast<const char*>(block), (std::streamsize) (count * sizeof(T)));
+                    count = 0;
+                }
+            }
+            delete[] block;
+        } else {
+            while (node != end) {
+                S::write(out, node->getData());
+                node = reversed ? node->getPrevNode() : node->getNextNode();
+            }
+        }
+        out.flush();
+        return out.good();
+    }
+
+    /**
+     * Writes a binary snapshot to a file descriptor. The descriptor is neither closed nor rewound.
+     * @tparam S Serializer used for the elements
+     * @param fd
+     * @return True if the whole snapshot has been written
+     */
+    template <typename S = Serializer<T>>
+    bool saveTo(int fd) {
+        FdStreamBuf buffer(fd);
+        std::ostream out(&buffer);
+        return saveTo<S>(out) && buffer.pubsync() == 0;
+    }
+
+    /**
+     * Replaces the contents of this QuickList with a snapshot written by saveTo. The distance for the final
+     * size is chosen up front and the JumpList is built while the nodes are linked, so no rebuilds occur.
+     * @tparam S Serializer used for the elements, must match the one used for saving
+     * @param in
+     * @return True if the snapshot was valid and has been loaded completely. The QuickList is empty otherwise.
+     */
+    template <typename S = Serializer<T>>
+    bool loadFrom(std::istream& in) {
+        constexpr bool raw = requires { requires S::rawBytes; };
+        clear();
+        reversed = false;
+
+        SnapshotHeader header;
+        if (!in.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        !std::equal(snapshotMagic, snapshotMagic + 4, header.magic) ||
+        header.version != snapshotVersion ||
+        header.elementSize != (raw ? sizeof(T) : 0) ||
+        header.size < 0)
+            return false;
+
+        distance = calcDistance(header.size);
+        origin = 0;
+
+        bool success = true;
+        if constexpr (raw) {
+            constexpr int blockSize = 4096;
+            T* block = new T[blockSize];
+            for (int64_t loaded = 0; success && loaded < header.size; loaded += blockSize) {
+                int64_t count = std::min<int64_t>(blockSize, header.size - loaded);
+                success = (bool) in.read(reinterpret_cast<char*>(block), (std::streamsize) (count * sizeof(T)));
+                for (int64_t i = 0; success && i < count; i++) {
+                    auto* node = this->newNode();
+                    node->setData(block[i]);
+                    appendBuiltNode(node);
+                }
+            }
+            delete[] block;
+        } else {
+            T data;
+            for (int64_t loaded = 0; success && loaded < header.size; loaded++) {
+                success = S::read(in, data);
+                if (success) {
+                    auto* node = this->newNode();
+                    node->setData(data);
+                    appendBuiltNode(node);
+                }
+            }
+        }
+
+        if (!success)
+            clear();
+        else if (fingerprintHash != nullptr)
+            rehashFingerprints();
+        return success;
+    }
+
+    /**
+     * Replaces the contents of this QuickList with a snapshot read from a file descriptor. The descriptor
+     * is neither closed nor rewound, and is left right behind the snapshot.
+     * @tparam S Serializer used for the elements, must match the one used for saving
+     * @param fd
+     * @return True if the snapshot was valid and has been loaded completely
+     */
+    template <typename S = Serializer<T>>
+    bool loadFrom(int fd) {
+        FdStreamBuf buffer(fd);
+        std::istream in(&buffer);
+        return loadFrom<S>(in);
+    }
+
+    /**
+     * Updates the values of a finger and marks it as most recently used.
+     * The jumpPointer must be the JumpPointer at or below the index, as returned by getJumpOrdinal.
+     * @param finger Position of the finger in fingers
+     * @param index Last used index
+     * @param node Last used node
+     * @param jumpPointer Last used jumpPointer
+     */
+    void setFinger(int finger, int64_t index, Node<T>* node, Node<Node<T>*>* jumpPointer) {
+        fingers[finger].index = index;
+        fingers[finger].node = node;
+        fingers[finger].jumpPointer = jumpPointer;
+        fingers[finger].lastUse = ++fingerClock;
+    }
+
+    /**
+     * Updates the finger that is at most one distance away from the index, as it most likely belongs
+     * to the same access stream, or the least recently used finger if there is none.
+     * @param index Last used index
+     * @param node Last used node
+     * @param jumpPointer Last used jumpPointer
+     */
+    void setTrailingPointer(int64_t index, Node<T>* node, Node<Node<T>*>* jumpPointer) {
+        int finger = nearestFinger(index);
+        if (finger == -1 || std::abs(index - fingers[finger].index) > distance)
+            finger = leastRecentlyUsedFinger();
+        setFinger(finger, index, node, jumpPointer);
+    }
+
+    /**
+     * @return The most recently used finger, invalid if no finger is valid
+     */
+    TrailingPointer& trailingPointer() {
+        int latest = 0;
+        for (int i = 1; i < fingerCount; i++)
+            if (fingers[i].lastUse > fingers[latest].lastUse)
+                latest = i;
+        return fingers[latest];
+    }
+
+    /**
+     * @param index
+     * @return Position of the valid finger nearest to the index in fingers, -1 if no finger is valid
+     */
+    int nearestFinger(int64_t index) {
+        int nearest = -1;
+        for (int i = 0; i < fingerCount; i++) {
+            if (fingers[i].index != -1 &&
+            (nearest == -1 || std::abs(index - fingers[i].index) < std::abs(index - fingers[nearest].index)))
+                nearest = i;
+        }
+        return nearest;
+    }
+
+    /**
+     * @return Position of the least recently used finger in fingers. Invalid fingers are used least recently.
+     */
+    int leastRecentlyUsedFinger() {
+        int oldest = 0;
+        for (int i = 1; i < fingerCount; i++)
+            if (fingers[i].lastUse < fingers[oldest].lastUse)
+                oldest = i;
+        return oldest;
+    }
+
+    /**
+     * Moves the fingers at or behind the index one index up along with their nodes, after a node has been
+     * inserted at the index and the JumpPointers have been shifted to the left
+     * @param index
+     */
+    void shiftFingersAfterInsert(int64_t index) {
+        for (TrailingPointer& finger : fingers) {
+            if (finger.index == -1 || finger.index < index)
+                continue;
+            finger.index++;
+            if (indexHasJumpPointer(finger.index))
+                finger.jumpPointer = finger.jumpPointer->getNextNode();
+            //The JumpPointer for a new last node is only appended afterwards
+            if (finger.jumpPointer == jumpList.getTail())
+                finger = TrailingPointer();
+        }
+    }
+
+    /**
+     * Moves the fingers behind the index one index down along with their nodes, and the fingers at the index
+     * to the node behind it, before the node at the index is removed
+     * @param index
+     * @param node The node at the index
+     */
+    void shiftFingersBeforeErase(int64_t index, Node<T>* node) {
+        for (TrailingPointer& finger : fingers) {
+            if (finger.index == -1 || finger.index < index)
+                continue;
+            if (finger.index == index) {
+                finger.node = node->getNextNode();
+            } else {
+                if (indexHasJumpPointer(finger.index))
+                    finger.jumpPointer = finger.jumpPointer->getPrevNode();
+                finger.index--;
+            }
+            if (finger.node == this->getTail())
+                finger = TrailingPointer();
+        }
+    }
+
+    void forceInvalidateTrailingPointer() {
+        for (TrailingPointer& finger : fingers)
+            finger = TrailingPointer();
+    }
+
+    /**
+     * @return Share of the searches that needed the JumpList and started from a finger instead of from
+     * the head or tail of the JumpList, 0 if there were none
+     */
+    double fingerHitRate() {
+        return fingerSearches == 0 ? 0 : (double) fingerHits / (double) fingerSearches;
+    }
+
+    /**
+     * Resets the counters behind fingerHitRate() and searchSteps
+     */
+    void resetFingerStatistics() {
+        fingerSearches = 0;
+        fingerHits = 0;
+        searchSteps = 0;
+    }
+
+    /**
+     * @param index
+     * @return The position of the index on the JumpPointer grid
+     */
+    int64_t gridIndex(int64_t index) {return index + origin;}
+
     /**
      * This method returns its result only by using arithmetics with the
-     * distance variable. This means that it may return true even if the
+     * distance and origin variables. This means that it may return true even if the
      * index is out of range.
      * @param index
-     * @return True if index has a JumpPointer
+     * @return True if index has a JumpPointer
+     */
+    bool indexHasJumpPointer(int64_t index) {return (gridIndex(index) + 1) % distance == 0;}
+
+    /**
+     * @param index
+     * @return The position of the JumpPointer at or below the index within the JumpList, -1 for the JumpList head
+     */
+    int64_t getJumpOrdinal(int64_t index) {return (gridIndex(index) + 1) / distance - 1;}
+
+    /**
+     * @param ordinal Position within the JumpList, -1 for its head and its size for its tail
+     * @return The index of the node that is pointed to by the JumpPointer, -1 for the head and size for the tail
+     */
+    int64_t getJumpOrdinalIndex(int64_t ordinal) {
+        if (ordinal < 0)
+            return -1;
+        if (ordinal >= jumpList.getSize())
+            return this->getSize();
+        return (ordinal + 1) * distance - 1 - origin;
+    }
+
+    /**
+     * Scenario: JumpPointers point to indices 119, 139, 159, and you want to get the nearest index of the node
+     * that is pointed to by a JumpPointer. Input index is 155. This method will return 139 then (It is always
+     * the previous node that is returned, never the next, even if the next one is nearer, like in this case).
+     * If the input index is equal to the index of a node pointed to by a JumpPointer, that same index is
+     * returned, e.g. 139 if your input is 139 in the above example.
+     * @param index
+     * @return The index of the node that is pointed to by a JumpPointer, -1 if there is none below the index
      */
-    bool indexHasJumpPointer(int index) {return (index + 1) % distance == 0;}
+    int64_t getJumpIndex(int64_t index) {return getJumpOrdinalIndex(getJumpOrdinal(index));}
 
     /**
-     * @param index
-     * @return True if the JumpPointer should be traversed backwards for better efficiency
+     * Checks if iterating the JumpList from the JumpPointer of a finger is at least as
+     * efficient as iterating it from its head or tail
+     * @param finger Position of the finger in fingers, -1 for none
+     * @param index The searched-for index
+     * @return True if search with the finger is to be used
      */
-    bool iterateJumpPointerBackwards(int index) {
-        int jumpIndex = getJumpIndex(index);
-        int nextJumpIndex = jumpIndex + distance;
-        return index - jumpIndex > nextJumpIndex - index;
+    bool fingerViable(int finger, int64_t index) {
+        if (finger == -1)
+            return false;
+        int64_t ordinal = getJumpOrdinal(index);
+        int64_t jumpSteps = std::abs(ordinal - getJumpOrdinal(fingers[finger].index));
+        return jumpSteps <= ordinal + 1 && jumpSteps <= jumpList.getSize() - ordinal;
     }
 
-    typedef struct TrailingSearchNode {
-        Node<T>* node;
-        int indexOffset;
-    } TrailingSearchNode;
-
-    TrailingSearchNode bestTrailingPointer(int index) {
-        //0 is prevJPtr
-        //1 is trailingPtr
-        //2 is nextJPtr
-        int difference[3];
-        int prevJPtrIndex = getJumpIndex(index);
-        int nextJPtrIndex = prevJPtrIndex + distance;
-
-        difference[0] = index - prevJPtrIndex;
-        difference[1] = index - trailingPointer.index;
-        difference[2] = index - nextJPtrIndex;
-
-        TrailingSearchNode t;
-
-        if (abs(difference[0]) < abs(difference[1])) {
-            t.node = trailingPointer.jumpPointer->getData();
-            t.indexOffset = difference[0];
-        } else if (nextJPtrIndex < this->getMaxIndex() && abs(difference[2]) < abs(difference[1])) {
-            t.node = trailingPointer.jumpPointer->getNextNode()->getData();
-            t.indexOffset = difference[2];
+    /**
+     * Iterates the JumpList from its head or its tail, whichever is nearer
+     * @param ordinal Position within the JumpList, -1 for its head
+     * @return The JumpPointer
+     */
+    Node<Node<T>*>* jumpPointerAt(int64_t ordinal) {
+        Node<Node<T>*>* jumpPointer;
+        searchSteps += std::min(ordinal + 1, jumpList.getSize() - ordinal);
+        if (ordinal + 1 <= jumpList.getSize() - ordinal) {
+            jumpPointer = jumpList.getHead();
+            for (int64_t i = -1; i < ordinal; i++)
+                jumpPointer = jumpPointer->getNextNode();
         } else {
-            t.node = trailingPointer.node;
-            t.indexOffset = difference[1];
+            jumpPointer = jumpList.getTail();
+            for (int64_t i = jumpList.getSize(); i > ordinal; i--)
+                jumpPointer = jumpPointer->getPrevNode();
         }
-        return t;
+        return jumpPointer;
     }
 
-    searchResult trailingSearch(int index) {
-        searchResult r;
-        r.jumpPointer = trailingPointer.jumpPointer;
-        r.node = trailingPointer.node;
-
-        //Amount of steps that the JumpPointer has to jump
-        int jPtrOffset = trailingJumpPointerOffset(index);
-
-        //If the JumpPointer is in range, do not modify the values given by the TrailingPointer
-        if (jPtrOffset == 0) {
-            TrailingSearchNode t = bestTrailingPointer(index);
-
-            //Shift the node indexOffset times in the given direction
-            if (t.indexOffset > 0)
-                for (int i = 0; i < t.indexOffset; i++)
-                    t.node = t.node->getNextNode();
-            else if (t.indexOffset < 0)
-                for (int i = 0; i > t.indexOffset; i--)
-                    t.node = t.node->getPrevNode();
-
-            r.node = t.node;
-            setTrailingPointer(index, r.node, r.jumpPointer);
-            return r;
-
-        } else {
-            if (jPtrOffset > 0)
-                for (int i = 0; i < jPtrOffset; i++)
-                    r.jumpPointer= r.jumpPointer->getNextNode();
-            else
-                for (int i = jPtrOffset; i < 0; i++)
-                    r.jumpPointer= r.jumpPointer->getPrevNode();
-
-            if (indexHasJumpPointer(index)) {
-                r.node = r.jumpPointer->getData();
-                setTrailingPointer(index, r.node, r.jumpPointer);
-                return r;
-            }
-
-            bool iterateJPtrBackwards = iterateJumpPointerBackwards(index);
-            if (iterateJPtrBackwards)
-                r.jumpPointer= r.jumpPointer->getNextNode();
-
-            r.node = r.jumpPointer->getData();
-
-            if (iterateJPtrBackwards) {
-                for (int i = 0; i <= (distance - index % distance) - 2; i++)
-                    r.node = r.node->getPrevNode();
-                setTrailingPointer(index, r.node, r.jumpPointer->getPrevNode());
-            } else {
-                for (int i = 0; i <= index % distance; i++)
-                    r.node = r.node->getNextNode();
-                setTrailingPointer(index, r.node, r.jumpPointer);
-            }
-
-            return r;
-        }
+    /**
+     * Iterates the JumpList from the JumpPointer of a finger
+     * @param finger Position of a valid finger in fingers
+     * @param ordinal Position within the JumpList, -1 for its head
+     * @return The JumpPointer
+     */
+    Node<Node<T>*>* fingerJumpPointerAt(int finger, int64_t ordinal) {
+        Node<Node<T>*>* jumpPointer = fingers[finger].jumpPointer;
+        int64_t offset = ordinal - getJumpOrdinal(fingers[finger].index);
+        searchSteps += std::abs(offset);
+        for (; offset > 0; offset--)
+            jumpPointer = jumpPointer->getNextNode();
+        for (; offset < 0; offset++)
+            jumpPointer = jumpPointer->getPrevNode();
+        return jumpPointer;
     }
 
-    searchResult nonTrailingSearch(int index) {
-        searchResult r;
-        //Ask for jumpList iteration direction
-        bool forward = this->useForwardSearch(index);
-        bool iterateJPtrBackwards = iterateJumpPointerBackwards(index);
-
-        //Decide starting point of search
-        forward ?
-        r.jumpPointer= jumpList.getHead():
-        r.jumpPointer= jumpList.getTail();
-
-        //Check if jumpList should be iterated or if search should start at the head
-        //Depending on where search starts, the jumpList has to iterate forwards or backwards
-        if (forward) {
-            for (int i = 0; jumpList.hasNext(r.jumpPointer); i++, r.jumpPointer= r.jumpPointer->getNextNode())
-                if (i == index / distance)
-                    break;
-        } else {
-            for (int i = -1; jumpList.hasPrev(r.jumpPointer); i++, r.jumpPointer= r.jumpPointer->getPrevNode())
-                if (i == jumpList.getSize() - (index / distance))
-                    break;
-        }
-
-        if (indexHasJumpPointer(index)) {
-            r.jumpPointer= r.jumpPointer->getNextNode();
-            r.node = r.jumpPointer->getData();
-            setTrailingPointer(index, r.node, r.jumpPointer);
-            return r;
+    /**
+     * Iterates to the node at the index, starting from whichever node is nearest: the one pointed to by the
+     * given JumpPointer, the one pointed to by the next JumpPointer (or the tail) or the node of the finger.
+     * @param index
+     * @param jumpPointer The JumpPointer at or below the index
+     * @param finger Position of the finger in fingers, -1 for none
+     * @param fromFinger Receives whether the walk started from the node of the finger
+     * @return The search result
+     */
+    searchResult walkFromJumpPointer(int64_t index, Node<Node<T>*>* jumpPointer, int finger, bool& fromFinger) {
+        int64_t ordinal = getJumpOrdinal(index);
+        Node<T>* node = jumpPointer->getData();
+        int64_t steps = index - getJumpOrdinalIndex(ordinal);
+
+        int64_t nextSteps = index - getJumpOrdinalIndex(ordinal + 1);
+        if (-nextSteps < steps) {
+            node = jumpPointer->getNextNode()->getData();
+            steps = nextSteps;
         }
-        if (iterateJPtrBackwards)
-            r.jumpPointer= r.jumpPointer->getNextNode();
-
-        //Sets node to the data of the determined jumpPointer
-        r.node = r.jumpPointer->getData();
 
-        //Iterate from pointed-to node to desired node
-        if (iterateJPtrBackwards) {
-            for (int i = 0; i <= (distance - index % distance) - 2; i++)
-                r.node = r.node->getPrevNode();
-            setTrailingPointer(index, r.node, r.jumpPointer->getPrevNode());
-        } else {
-            for (int i = 0; i <= index % distance; i++)
-                r.node = r.node->getNextNode();
-            setTrailingPointer(index, r.node, r.jumpPointer);
+        fromFinger = finger != -1 && std::abs(index - fingers[finger].index) < std::abs(steps);
+        if (fromFinger) {
+            node = fingers[finger].node;
+            steps = index - fingers[finger].index;
         }
 
-        return r;
+        searchSteps += std::abs(steps);
+        for (; steps > 0; steps--)
+            node = node->getNextNode();
+        for (; steps < 0; steps++)
+            node = node->getPrevNode();
+        return {node, jumpPointer};
     }
 
     /**
@@ -398,23 +2245,12 @@ public:
      * @param index
      * @return The search result
      */
-    searchResult regularSearch(int index) {
+    searchResult regularSearch(int64_t index) {
         searchResult r;
-        //Ask for jumpList iteration direction
-        bool forward = this->useForwardSearch(index);
-
-        //Trailing JumpPointer must always be the previous jumpPointer
-        //, therefore we use
-        //the head when iterating forwards, but the penultimate one when iterating backwards.
-        r.jumpPointer= forward ?
-                jumpList.getHead():
-                jumpList.getLastNode();
-
-        if (index < jumpList.getSize() * distance - 1 && index > jumpList.getSize() * distance - distance - 1)
-            r.jumpPointer= r.jumpPointer->getPrevNode();
+        r.jumpPointer = jumpPointerAt(getJumpOrdinal(index));
 
         //Regular search algorithm
-        r.node = forward ?
+        r.node = this->useForwardSearch(index) ?
                 this->searchFromFront(index):
                 this->searchFromBack(index);
 
@@ -425,16 +2261,15 @@ public:
     /**
      * Is index 0? Then return the first node.
      * Is index n - 1? Then return the last node.
-     * Is index to be searched regularly? Return a regular search result.
-     * Is index out of range? Then return nullptr as a result; TrailingPointer is not modified.
+     * Is index out of range? Then return nullptr as a result; the fingers are not modified.
      * @param index
      * @return The search result and confirmation if a result has been found
      */
-    searchCheck constantSearchCheck(int index) {
+    searchCheck constantSearchCheck(int64_t index) {
         searchCheck check;
         if (index == 0) {
             check.r.node = this->getFirstNode();
-            check.r.jumpPointer= jumpList.getHead();
+            check.r.jumpPointer= indexHasJumpPointer(0) ? jumpList.getFirstNode() : jumpList.getHead();
             check.done = true;
             setTrailingPointer(index, check.r.node, check.r.jumpPointer);
         } else if (index == this->getMaxIndex()) {
@@ -451,72 +2286,178 @@ public:
 
     /**
      * May be referred to as 'QuickSearch', is the heart of the QuickList. Searches for the given index by using
-     * the QuickList's JumpList and TrailingPointer to speed up the search.
+     * the QuickList's JumpList and its fingers to speed up the search.
      * @param index
-     * @return The search result
+     * @return The search result. Its jumpPointer is the JumpPointer at or below the index.
      */
-    searchResult search(int index) {
+    searchResult search(int64_t index) {
+        pollBackgroundRebuild();
         //Check if index is in range and if it should return first or last node instead
         searchCheck check = constantSearchCheck(index);
         if (check.done)
             return check.r;
 
-        //Check if using the TrailingPointer to navigate the QuickList is most efficient
-        if (trailingPointerViable(index))
-            //Do a Trailing search if it is cost-efficient
-            return trailingSearch(index);
+        //Check if using the nearest finger to navigate the JumpList is most efficient
+        int finger = nearestFinger(index);
+        int64_t ordinal = getJumpOrdinal(index);
+        bool viable = fingerViable(finger, index);
+        bool fromFinger;
+        searchResult r = walkFromJumpPointer(index, viable ?
+                fingerJumpPointerAt(finger, ordinal):
+                jumpPointerAt(ordinal), finger, fromFinger);
+
+        //Move the finger along with its access stream, or replace the least recently used one
+        fingerSearches++;
+        if (viable || fromFinger)
+            fingerHits++;
         else
-            //Do a Non-Trailing search if starting from the head or tail is cost-efficient
-            return nonTrailingSearch(index);
+            finger = leastRecentlyUsedFinger();
+        setFinger(finger, index, r.node, r.jumpPointer);
+        return r;
+    }
+
+    /**
+     * @param index
+     * @param jumpPointer The JumpPointer at or below the index
+     * @return The first JumpPointer at or behind the index, i.e. the first one affected by inserting or removing
+     * a node at the index
+     */
+    Node<Node<T>*>* firstShiftedJumpPointer(int64_t index, Node<Node<T>*>* jumpPointer) {
+        return indexHasJumpPointer(index) ? jumpPointer : jumpPointer->getNextNode();
     }
 
     /**
      * Checks if appending or prepending is more efficient. Does so if it is.
      * @param index
      * @param data
-     * @return False if the index has to be searched
+     * @return The new node, nullptr if the index has to be searched
      */
-    bool addCheck(int index, T data) {
-        if (index - 1 >= this->getMaxIndex()) {
-            this->append(data);
-            return true;
-        }
-        if (index <= 0) {
-            this->prepend(data);
-            if (!jumpList.isEmpty())
-                jumpList.leftPointerShift(distance, index, jumpList.getFirstNode());
-            return true;
-        }
-        return false;
+    Node<T>* addCheck(int64_t index, T data) {
+        if (index - 1 >= this->getMaxIndex())
+            return this->append(data);
+        if (index <= 0)
+            return this->prepend(data);
+        return nullptr;
     }
 
     /**
      * Adds a new node to the list taking the given index by means of QuickSearch and shifts JumpPointers to the left.
      * @param index
      * @param data
+     * @return The new node, which stays valid as a handle until it is removed
      */
-    void add(int index, T data) {
-        if (addCheck(index, data))
-            return;
+    Node<T>* add(int64_t index, T data) {
+        if (reversed) {
+            PhysicalOrder physical(*this);
+            return add(this->getSize() - index, data);
+        }
+        Node<T>* node = addCheck(index, data);
+        if (node != nullptr)
+            return node;
+
+        if (recorder != nullptr)
+            recorder->record(TraceRecorder::ADD, index);
 
         searchResult r = search(index);
-        this->linkUpNode(new Node<T>, r.node, data);
-        jumpList.leftPointerShift(distance, index, r.jumpPointer);
-        setTrailingPointer(index, r.node->getPrevNode(), r.jumpPointer);
+        return insertLocated(index, r.node, r.jumpPointer, data);
+    }
+
+    /**
+     * Links a new node in front of nextNode, whose index and JumpPointer are already known, and shifts JumpPointers to the left.
+     * @param index The index of nextNode, which the new node will take
+     * @param nextNode
+     * @param jumpPointer The JumpPointer at or below the index
+     * @param data
+     * @return The new node
+     */
+    Node<T>* insertLocated(int64_t index, Node<T>* nextNode, Node<Node<T>*>* jumpPointer, T data) {
+        RebuildGuard rebuildGuard(*this);
+        if (!snapshots.empty() && index > 0)
+            preserveForSnapshots(index - 1, true);
+        if (!snapshots.empty())
+            shiftSnapshots(index, 1);
+
+        Node<Node<T>*>* shifted = firstShiftedJumpPointer(index, jumpPointer);
+        if (fingerprintHash != nullptr)
+            insertIntoFingerprints(index, nextNode, shifted, data);
+
+        auto* node = this->newNode();
+        this->linkNode(node, nextNode, data);
+        rebuildGuard.afterInsert(index, node);
+        if (valueIndex != nullptr)
+            valueIndex->insert(node);
+        jumpList.leftPointerShift(shifted);
+        shiftFingersAfterInsert(index);
+        setTrailingPointer(index, node, jumpPointer);
+        incSize();
+        return node;
     }
 
-    void prepend(T data) override {
-        auto* node = new Node<T>;
-        node->setData(data);
+    Node<T>* append(T data) override {
+        if (reversed) {
+            PhysicalOrder physical(*this);
+            return prepend(data);
+        }
+        pollBackgroundRebuild();
+        RebuildGuard rebuildGuard(*this);
+        if (recorder != nullptr)
+            recorder->record(TraceRecorder::APPEND, this->getSize());
+        //The new node always joins the last segment, which a JumpPointer appended for it leaves in place
+        if (fingerprintHash != nullptr)
+            fingerprints.back() = fingerprints.back() * fingerprintBase + fingerprintHash(data);
+        Node<T>* node = BaseList<T, Allocator>::append(data);
+        rebuildGuard.afterInsert(this->getMaxIndex(), node);
+        if (valueIndex != nullptr)
+            valueIndex->insert(node);
+        return node;
+    }
 
-        node->setPrevNode(this->getHead());
-        node->setNextNode(this->getFirstNode());
+    /**
+     * Prepends a node in O(1) by moving the origin of the JumpPointer grid instead of all JumpPointers.
+     * A JumpPointer is prepended whenever the new first node lands on a JumpPointer position.
+     * @param data
+     */
+    Node<T>* prepend(T data) override {
+        if (reversed) {
+            PhysicalOrder physical(*this);
+            return append(data);
+        }
+        pollBackgroundRebuild();
+        RebuildGuard rebuildGuard(*this);
+        if (recorder != nullptr)
+            recorder->record(TraceRecorder::PREPEND, 0);
+
+        if (fingerprintHash != nullptr) {
+            if (origin == 0)
+                fingerprints.push_front(fingerprintHash(data));
+            else
+                fingerprints.front() += fingerprintHash(data) * fingerprintPowers[segmentLength(0)];
+        }
 
-        this->getHead()->setNextNode(node);
-        node->getNextNode()->setPrevNode(node);
+        if (!snapshots.empty())
+            shiftSnapshots(0, 1);
+        auto* node = this->newNode();
+        this->linkNode(node, this->getFirstNode(), data);
+        rebuildGuard.afterInsert(0, node);
+        if (valueIndex != nullptr)
+            valueIndex->insert(node);
+
+        if (origin == 0) {
+            origin = distance - 1;
+            jumpList.prepend(node);
+            for (TrailingPointer& finger : fingers)
+                if (finger.jumpPointer == jumpList.getHead())
+                    finger.jumpPointer = jumpList.getFirstNode();
+        } else {
+            origin--;
+        }
+        for (TrailingPointer& finger : fingers)
+            if (finger.index != -1)
+                finger.index++;
 
-        jumpList.leftPointerShift(distance, 0, jumpList.getFirstNode());
-        incSize();
+        this->size++;
+        rebuildJumpList();
+        return node;
     }
 
     /**
@@ -524,12 +2465,10 @@ public:
      * @param index
      * @return False if index has to be searched
      */
-    bool removeCheck(int index) {
+    bool removeCheck(int64_t index) {
         if (index < 0 || index > this->getMaxIndex())
             return true;
         if (index == 0) {
-            if (!jumpList.isEmpty())
-                jumpList.rightPointerShift(distance, index, jumpList.getFirstNode());
             this->removeFirst();
             return true;
         } else if (index == this->getMaxIndex()) {
@@ -539,43 +2478,515 @@ public:
         return false;
     }
 
+    /**
+     * Removes the first node in O(1) by moving the origin of the JumpPointer grid instead of all JumpPointers.
+     * The first JumpPointer is removed along with the node if it pointed to it.
+     */
+    void removeFirst() override {
+        if (reversed) {
+            PhysicalOrder physical(*this);
+            removeLast();
+            return;
+        }
+        if (this->isEmpty())
+            return;
+        pollBackgroundRebuild();
+        RebuildGuard rebuildGuard(*this);
+        if (recorder != nullptr)
+            recorder->record(TraceRecorder::REMOVE, 0);
+
+        Node<T>* node = this->getFirstNode();
+        for (TrailingPointer& finger : fingers)
+            if (finger.index > 0)
+                finger.index--;
+        if (fingerprintHash != nullptr) {
+            if (origin == distance - 1)
+                fingerprints.pop_front();
+            else
+                fingerprints.front() -= fingerprintHash(node->data) * fingerprintPowers[segmentLength(0) - 1];
+        }
+
+        if (origin == distance - 1) {
+            for (TrailingPointer& finger : fingers)
+                if (finger.jumpPointer == jumpList.getFirstNode())
+                    finger.jumpPointer = jumpList.getHead();
+            jumpList.removeFirst();
+            origin = 0;
+        } else {
+            origin++;
+        }
+
+        //Fingers on the removed node move to the new first node
+        for (TrailingPointer& finger : fingers) {
+            if (finger.node != node)
+                continue;
+            if (node->getNextNode() == this->getTail()) {
+                finger = TrailingPointer();
+            } else {
+                finger.node = node->getNextNode();
+                finger.jumpPointer = indexHasJumpPointer(0) ? jumpList.getFirstNode() : jumpList.getHead();
+            }
+        }
+
+        if (!snapshots.empty()) {
+            preserveForSnapshots(0, false);
+            shiftSnapshots(0, -1);
+        }
+        if (valueIndex != nullptr)
+            valueIndex->erase(node);
+        rebuildGuard.beforeErase(0, node);
+        node->unlink();
+        this->deleteNode(node);
+        this->size--;
+        rebuildJumpList();
+    }
+
+    void removeLast() override {
+        if (reversed) {
+            PhysicalOrder physical(*this);
+            removeFirst();
+            return;
+        }
+        if (this->isEmpty())
+            return;
+        pollBackgroundRebuild();
+        RebuildGuard rebuildGuard(*this);
+        if (recorder != nullptr)
+            recorder->record(TraceRecorder::REMOVE, this->getMaxIndex());
+
+        //Fingers on the removed node move to the new last node
+        Node<T>* node = this->getLastNode();
+        for (TrailingPointer& finger : fingers) {
+            if (finger.node != node)
+                continue;
+            if (this->getSize() == 1) {
+                finger = TrailingPointer();
+            } else {
+                if (indexHasJumpPointer(finger.index))
+                    finger.jumpPointer = finger.jumpPointer->getPrevNode();
+                finger.index--;
+                finger.node = node->getPrevNode();
+            }
+        }
+
+        if (!snapshots.empty())
+            preserveForSnapshots(this->getMaxIndex(), false);
+        if (valueIndex != nullptr)
+            valueIndex->erase(this->getLastNode());
+        if (fingerprintHash != nullptr) {
+            uint64_t& hash = fingerprints[segmentOf(this->getMaxIndex())];
+            hash = (hash - fingerprintHash(node->data)) * fingerprintBaseInverse;
+        }
+        rebuildGuard.beforeErase(this->getMaxIndex(), node);
+        BaseList<T, Allocator>::removeNode(this->getLastNode());
+    }
+
     /**
      * Removes the node at the given index by means of QuickSearch and shifts JumpPointers to the right.
      * @param index
      */
-    void remove(int index) override {
-        invalidateTrailingPointer(index);
+    void remove(int64_t index) override {
+        if (reversed) {
+            PhysicalOrder physical(*this);
+            remove(mirrorIndex(index));
+            return;
+        }
         if (removeCheck(index))
             return;
+        if (recorder != nullptr)
+            recorder->record(TraceRecorder::REMOVE, index);
 
         searchResult r = search(index);
-        jumpList.rightPointerShift(distance, index, r.jumpPointer);
-        this->removeNode(r.node);
+        eraseLocated(index, r.node, r.jumpPointer);
+    }
+
+    /**
+     * Removes a node whose index and JumpPointer are already known and shifts JumpPointers to the right.
+     * @param index The index of the node
+     * @param node
+     * @param jumpPointer The JumpPointer at or below the index
+     */
+    void eraseLocated(int64_t index, Node<T>* node, Node<Node<T>*>* jumpPointer) {
+        RebuildGuard rebuildGuard(*this);
+        if (!snapshots.empty()) {
+            preserveForSnapshots(index, false);
+            shiftSnapshots(index, -1);
+        }
+        if (valueIndex != nullptr)
+            valueIndex->erase(node);
+        Node<Node<T>*>* shifted = firstShiftedJumpPointer(index, jumpPointer);
+        if (fingerprintHash != nullptr)
+            eraseFromFingerprints(index, node, shifted);
+        jumpList.rightPointerShift(shifted);
+        shiftFingersBeforeErase(index, node);
+        setTrailingPointer(index, node->getNextNode(), jumpPointer);
+        rebuildGuard.beforeErase(index, node);
+        BaseList<T, Allocator>::removeNode(node);
+    }
+
+    /**
+     * Finds the index of a node and the JumpPointer at or below it in O(√n). Walks at most distance nodes
+     * forward, which always reaches a node pointed to by a JumpPointer, the node of a finger or the tail,
+     * and then looks that node up in the JumpList from both of its ends. The walked nodes are remembered in
+     * locateTable, which is reused between calls, so that locating does not allocate.
+     * @param node A node of this QuickList
+     * @param jumpPointer Receives the JumpPointer at or below the node
+     * @return The index of the node, -1 if it does not belong to this QuickList
+     */
+    int64_t locate(Node<T>* node, Node<Node<T>*>*& jumpPointer) {
+        //Open addressing table of at most distance entries, filled to half of its capacity at most
+        int shift = 64 - std::bit_width((uint64_t) distance);
+        size_t capacity = (size_t) 1 << (64 - shift + 1);
+        if (locateTable.size() < capacity)
+            locateTable.resize(capacity);
+        std::fill(locateTable.begin(), locateTable.begin() + (int64_t) capacity, std::pair<Node<T>*, int64_t>(nullptr, 0));
+        auto slotOf = [shift](Node<T>* key) {
+            return (size_t) (((uint64_t) (uintptr_t) key * 0x9E3779B97F4A7C15ull) >> (shift - 1));
+        };
+
+        Node<T>* ahead = node;
+        for (int64_t i = 0; i < distance && ahead != nullptr; i++, ahead = ahead->getNextNode()) {
+            for (int finger = 0; finger < fingerCount; finger++) {
+                if (ahead == fingers[finger].node) {
+                    int64_t index = fingers[finger].index - i;
+                    jumpPointer = fingerJumpPointerAt(finger, getJumpOrdinal(index));
+                    return index;
+                }
+            }
+            if (ahead == this->getTail()) {
+                int64_t index = this->getSize() - i;
+                jumpPointer = jumpPointerAt(getJumpOrdinal(index));
+                return index;
+            }
+            size_t slot = slotOf(ahead);
+            while (locateTable[slot].first != nullptr)
+                slot = (slot + 1) & (capacity - 1);
+            locateTable[slot] = {ahead, i};
+        }
+
+        Node<Node<T>*>* front = jumpList.getFirstNode();
+        Node<Node<T>*>* back = jumpList.getLastNode();
+        for (int64_t ordinal = 0; ordinal < (jumpList.getSize() + 1) / 2; ordinal++) {
+            for (Node<Node<T>*>* candidate : {front, back}) {
+                size_t slot = slotOf(candidate->getData());
+                while (locateTable[slot].first != nullptr && locateTable[slot].first != candidate->getData())
+                    slot = (slot + 1) & (capacity - 1);
+                if (locateTable[slot].first != nullptr) {
+                    int64_t steps = locateTable[slot].second;
+                    int64_t candidateOrdinal = candidate == front ? ordinal : jumpList.getMaxIndex() - ordinal;
+                    jumpPointer = steps == 0 ? candidate : candidate->getPrevNode();
+                    return getJumpOrdinalIndex(candidateOrdinal) - steps;
+                }
+            }
+            front = front->getNextNode();
+            back = back->getPrevNode();
+        }
+        return -1;
+    }
+
+
+    /**
+     * Finds the index of a node in O(√n) by walking to the nearest JumpPointer
+     * @param node A node of this QuickList, e.g. a handle returned by add/append/prepend/insertBefore
+     * @return The index of the node, -1 if it does not belong to this QuickList
+     */
+    int64_t indexOf(Node<T>* node) {
+        Node<Node<T>*>* jumpPointer;
+        int64_t index = locate(node, jumpPointer);
+        if (index == -1)
+            return -1;
+        setTrailingPointer(index, node, jumpPointer);
+        return reversed ? mirrorIndex(index) : index;
+    }
+
+    /**
+     * Inserts a new node in front of the given node, keeping the JumpList consistent
+     * @param nextNode A node of this QuickList or its tail to append
+     * @param data
+     * @return The new node, nullptr if nextNode does not belong to this QuickList, which is left unchanged
+     */
+    Node<T>* insertBefore(Node<T>* nextNode, T data) {
+        if (reversed) {
+            PhysicalOrder physical(*this);
+            return insertBefore(nextNode == this->getTail() ? this->getFirstNode() : nextNode->getNextNode(), data);
+        }
+        if (nextNode == this->getTail())
+            return append(data);
+        if (nextNode == this->getFirstNode())
+            return prepend(data);
+
+        Node<Node<T>*>* jumpPointer;
+        int64_t index = locate(nextNode, jumpPointer);
+        if (index == -1)
+            return nullptr;
+        if (recorder != nullptr)
+            recorder->record(TraceRecorder::ADD, index);
+        return insertLocated(index, nextNode, jumpPointer, data);
+    }
+
+    /**
+     * Inserts copies of the elements of [first, last) in front of the node at the index. The new nodes are
+     * linked as one chain after a single QuickSearch and the JumpPointers behind the index are repaired once,
+     * which costs O(√n + k + n / distance * min(k mod distance, distance - k mod distance)) for k elements
+     * instead of k searches and k shifts of the JumpList. Indices out of range prepend or append like add does.
+     * @param index
+     * @param first
+     * @param last
+     * @return The first new node, nullptr if the range is empty
+     */
+    template <typename InputIt>
+    Node<T>* insertRange(int64_t index, InputIt first, InputIt last) {
+        Node<T>* chainFirst = nullptr;
+        Node<T>* chainLast = nullptr;
+        int64_t count = 0;
+        for (; first != last; ++first, ++count)
+            addToChain(chainFirst, chainLast, *first);
+        return insertChain(index, chainFirst, chainLast, count);
+    }
+
+    /**
+     * Moves all elements of the other QuickList in front of the node at the index like insertRange does.
+     * The nodes themselves cannot be taken over, as every QuickList allocates its nodes from its own pool.
+     * The other QuickList is empty afterwards.
+     * @param index
+     * @param other
+     * @return The first new node, nullptr if the other QuickList is empty
+     */
+    Node<T>* insertList(int64_t index, QuickList&& other) {
+        Node<T>* chainFirst = nullptr;
+        Node<T>* chainLast = nullptr;
+        Node<T>* node = other.reversed ? other.getLastNode() : other.getFirstNode();
+        Node<T>* end = other.reversed ? other.getHead() : other.getTail();
+        while (node != end) {
+            addToChain(chainFirst, chainLast, std::move(node->data));
+            node = other.reversed ? node->getPrevNode() : node->getNextNode();
+        }
+        int64_t count = other.getSize();
+        other.clear();
+        return insertChain(index, chainFirst, chainLast, count);
+    }
+
+    /**
+     * Allocates a node behind the last node of a chain that is not linked into the QuickList yet, or in front of
+     * its first node if the QuickList is reversed
+     * @param chainFirst First node of the chain, nullptr if the chain is empty
+     * @param chainLast Last node of the chain, nullptr if the chain is empty
+     * @param data
+     */
+    void addToChain(Node<T>*& chainFirst, Node<T>*& chainLast, T data) {
+        Node<T>* node = this->newNode();
+        node->setData(std::move(data));
+        if (chainFirst == nullptr) {
+            chainFirst = node;
+            chainLast = node;
+        } else if (reversed) {
+            node->setNextNode(chainFirst);
+            chainFirst->setPrevNode(node);
+            chainFirst = node;
+        } else {
+            node->setPrevNode(chainLast);
+            chainLast->setNextNode(node);
+            chainLast = node;
+        }
+    }
+
+    /**
+     * Splices a chain built by addToChain in at the index
+     * @param index
+     * @param chainFirst
+     * @param chainLast
+     * @param count Length of the chain
+     * @return The first new node in the order of the QuickList, nullptr if the chain is empty
+     */
+    Node<T>* insertChain(int64_t index, Node<T>* chainFirst, Node<T>* chainLast, int64_t count) {
+        if (reversed) {
+            PhysicalOrder physical(*this);
+            spliceChain(this->getSize() - index, chainFirst, chainLast, count);
+            return chainLast;
+        }
+        return spliceChain(index, chainFirst, chainLast, count);
+    }
+
+    /**
+     * Links a chain of new nodes in front of the node at the index and repairs the JumpList once. The JumpPointers
+     * behind the index are rebuilt from their old nodes, each of which is at most distance / 2 nodes away from
+     * its new node, unless the QuickList reaches its upper critical size and gets rebuilt anyway.
+     * @param index
+     * @param chainFirst
+     * @param chainLast
+     * @param count Length of the chain
+     * @return The first node of the chain
+     */
+    Node<T>* spliceChain(int64_t index, Node<T>* chainFirst, Node<T>* chainLast, int64_t count) {
+        if (count == 0)
+            return nullptr;
+        cancelBackgroundRebuild();
+        index = std::clamp<int64_t>(index, 0, this->getSize());
+        if (recorder != nullptr)
+            for (int64_t i = 0; i < count; i++)
+                recordInsert(index + i, this->getSize() + i);
+
+        Node<T>* nextNode = this->getTail();
+        Node<Node<T>*>* shifted = jumpList.getTail();
+        if (index < this->getSize()) {
+            searchResult r = search(index);
+            nextNode = r.node;
+            shifted = firstShiftedJumpPointer(index, r.jumpPointer);
+        }
+        if (!snapshots.empty() && index > 0)
+            preserveForSnapshots(index - 1, true);
+        if (!snapshots.empty())
+            shiftSnapshots(index, count);
+
+        chainFirst->setPrevNode(nextNode->getPrevNode());
+        chainLast->setNextNode(nextNode);
+        chainFirst->setNextOfPrev(chainFirst);
+        nextNode->setPrevNode(chainLast);
+        if (valueIndex != nullptr)
+            for (Node<T>* node = chainFirst; node != nextNode; node = node->getNextNode())
+                valueIndex->insert(node);
+
+        for (TrailingPointer& finger : fingers)
+            if (finger.index >= index)
+                finger = TrailingPointer();
+        this->size += count;
+        if (this->getSize() >= upperCritical()) {
+            forceRebuildJumpList();
+            return chainFirst;
+        }
+
+        //Old nodes of the JumpPointers at or behind the index, which are replaced below
+        std::vector<Node<T>*> shiftedNodes;
+        for (; shifted != jumpList.getTail(); shifted = shifted->getNextNode())
+            shiftedNodes.push_back(shifted->getData());
+        for (size_t i = 0; i < shiftedNodes.size(); i++)
+            jumpList.removeLast();
+
+        int64_t firstOrdinal = jumpList.getSize();
+        int64_t wholeDistances = count / distance;
+        int64_t remainder = count % distance;
+        Node<Node<T>*>* lastInsertedJumpPointer = jumpList.getLastNode();
+        Node<T>* chainNode = chainFirst;
+        int64_t chainIndex = index;
+
+        for (int64_t ordinal = firstOrdinal; ; ordinal++) {
+            int64_t position = (ordinal + 1) * distance - 1 - origin;
+            if (position > this->getMaxIndex())
+                break;
+
+            if (position < index + count) {
+                for (; chainIndex < position; chainIndex++)
+                    chainNode = chainNode->getNextNode();
+                jumpList.append(chainNode);
+                lastInsertedJumpPointer = jumpList.getLastNode();
+                continue;
+            }
+
+            //The node at the position was remainder nodes in front of the old node of the JumpPointer
+            //wholeDistances ordinals below, or distance - remainder nodes behind the one before that
+            int64_t old = ordinal - wholeDistances - firstOrdinal;
+            Node<T>* node = this->getTail();
+            int64_t steps = position - this->getSize();
+            if (old < (int64_t) shiftedNodes.size() && remainder <= -steps) {
+                node = shiftedNodes[old];
+                steps = -remainder;
+            }
+            if (old >= 1 && old <= (int64_t) shiftedNodes.size() && distance - remainder < std::abs(steps)) {
+                node = shiftedNodes[old - 1];
+                steps = distance - remainder;
+            }
+            for (; steps > 0; steps--)
+                node = node->getNextNode();
+            for (; steps < 0; steps++)
+                node = node->getPrevNode();
+            jumpList.append(node);
+        }
+
+        //Every segment behind the index has shifted by the remainder
+        if (fingerprintHash != nullptr) {
+            fingerprints.resize(jumpList.getSize() + 1);
+            rehashSegments(segmentOf(index), jumpList.getSize());
+        }
+        setTrailingPointer(index + count - 1, chainLast, lastInsertedJumpPointer);
+        return chainFirst;
+    }
+
+    /**
+     * Records an insertion the way add would have recorded it
+     * @param index
+     * @param size Size before the insertion
+     */
+    void recordInsert(int64_t index, int64_t size) {
+        if (index >= size)
+            recorder->record(TraceRecorder::APPEND, size);
+        else if (index == 0)
+            recorder->record(TraceRecorder::PREPEND, 0);
+        else
+            recorder->record(TraceRecorder::ADD, index);
+    }
+
+    /**
+     * Removes the given node, keeping the JumpList consistent
+     * @param node A node of this QuickList
+     * @return The node that followed the removed node, nullptr if the node does not belong to this QuickList,
+     * which is left unchanged
+     */
+    Node<T>* eraseAt(Node<T>* node) {
+        if (reversed) {
+            Node<T>* next = node->getPrevNode();
+            PhysicalOrder physical(*this);
+            if (eraseAt(node) == nullptr)
+                return nullptr;
+            return next == this->getHead() ? this->getTail() : next;
+        }
+        Node<T>* next = node->getNextNode();
+        if (node == this->getFirstNode() || node == this->getLastNode()) {
+            node == this->getFirstNode() ? removeFirst() : removeLast();
+            return next;
+        }
+
+        Node<Node<T>*>* jumpPointer;
+        int64_t index = locate(node, jumpPointer);
+        if (index == -1)
+            return nullptr;
+        if (recorder != nullptr)
+            recorder->record(TraceRecorder::REMOVE, index);
+        eraseLocated(index, node, jumpPointer);
+        return next;
+    }
+
+    /**
+     * Keeps the JumpList consistent when nodes are removed through BaseList, e.g. by removeFirstOccurrence
+     * @param node
+     */
+    void removeNode(Node<T>* node) override {
+        eraseAt(node);
     }
 
     /**
      * Checks if removing a range can be made more efficient. Does so if it is.
+     * Also brings the range into order and clamps its start.
      * @param indexStart
      * @param indexEnd
      * @return
      */
-    bool rangeCheck(int indexStart, int indexEnd) {
-        if (indexStart > this->getMaxIndex())
-            return true;
-        if (indexStart < 0)
-            indexStart = 0;
+    bool rangeCheck(int64_t& indexStart, int64_t& indexEnd) {
         if (indexEnd < indexStart) {
-            int temp = indexStart;
+            int64_t temp = indexStart;
             indexStart = indexEnd;
             indexEnd = temp;
         }
+        if (indexStart > this->getMaxIndex())
+            return true;
+        if (indexStart < 0)
+            indexStart = 0;
         if (indexStart == indexEnd) {
             remove(indexStart);
             return true;
         }
         if (indexEnd > this->getMaxIndex()) {
             indexEnd = this->getMaxIndex();
-            for (int i = 0; i <= indexEnd - indexStart; i++)
+            for (int64_t i = 0; i <= indexEnd - indexStart; i++)
                 this->removeLast();
             return true;
         }
@@ -589,20 +3000,42 @@ public:
      * @param indexStart The first node by index (inclusive)
      * @param indexEnd The last node by index (inclusive)
      */
-    void removeRange(int indexStart, int indexEnd) {
+    void removeRange(int64_t indexStart, int64_t indexEnd) {
+        if (reversed) {
+            if (indexEnd < indexStart)
+                std::swap(indexStart, indexEnd);
+            if (indexStart > this->getMaxIndex() || indexEnd < 0)
+                return;
+            indexStart = std::max<int64_t>(indexStart, 0);
+            indexEnd = std::min(indexEnd, this->getMaxIndex());
+            PhysicalOrder physical(*this);
+            removeRange(mirrorIndex(indexEnd), mirrorIndex(indexStart));
+            return;
+        }
         if (rangeCheck(indexStart, indexEnd))
             return;
 
+        cancelBackgroundRebuild();
+        detachSnapshots();
+        if (recorder != nullptr)
+            for (int64_t i = indexStart; i <= indexEnd; i++)
+                recorder->record(TraceRecorder::REMOVE, indexStart);
         searchResult r = search(indexStart);
         Node<T>* node;
-        for (int i = 0; i <= indexEnd - indexStart; i++) {
+        for (int64_t i = 0; i <= indexEnd - indexStart; i++) {
             node = r.node->getNextNode();
+            if (valueIndex != nullptr)
+                valueIndex->erase(r.node);
             r.node->unlink();
-            delete r.node;
+            this->deleteNode(r.node);
             r.node = node;
         }
-        this->size -= indexEnd - indexStart;
-        rebuildJumpList();
+        this->size -= indexEnd - indexStart + 1;
+        forceRebuildJumpList();
+
+        //The rebuild costs O(n) anyway, so the finger is re-anchored behind the removed range
+        if (indexStart <= this->getMaxIndex())
+            setTrailingPointer(indexStart, r.node, jumpPointerAt(getJumpOrdinal(indexStart)));
     }
 
     /**
@@ -610,9 +3043,45 @@ public:
      * @param index
      * @param data
      */
-    void set(int index, T data) override {
+    void set(int64_t index, T data) override {
+        if (reversed) {
+            PhysicalOrder physical(*this);
+            set(mirrorIndex(index), data);
+            return;
+        }
+        if (recorder != nullptr)
+            recorder->record(TraceRecorder::SET, index);
+
         searchResult r = search(index);
+        if (!snapshots.empty())
+            preserveForSnapshots(index, false);
+        if (valueIndex != nullptr)
+            valueIndex->erase(r.node);
+        if (fingerprintHash != nullptr) {
+            int64_t segment = segmentOf(index);
+            int64_t offset = index - getJumpOrdinalIndex(segment - 1) - 1;
+            fingerprints[segment] += (fingerprintHash(data) - fingerprintHash(r.node->data)) *
+                    fingerprintPowers[segmentLength(segment) - 1 - offset];
+        }
         r.node->setData(data);
+        if (valueIndex != nullptr)
+            valueIndex->insert(r.node);
+    }
+
+    void setFirst(T data) {
+        set(0, data);
+    }
+
+    void setLast(T data) {
+        set(this->getMaxIndex(), data);
+    }
+
+    T getFirst() {
+        return reversed ? this->getLastNode()->getData() : this->getFirstNode()->getData();
+    }
+
+    T getLast() {
+        return reversed ? this->getFirstNode()->getData() : this->getLastNode()->getData();
     }
 
     /**
@@ -620,8 +3089,151 @@ public:
      * @param index
      * @return
      */
-    T get(int index) override {
+    T get(int64_t index) override {
+        if (reversed) {
+            PhysicalOrder physical(*this);
+            return get(mirrorIndex(index));
+        }
+        if (recorder != nullptr)
+            recorder->record(TraceRecorder::GET, index);
+
         searchResult r = search(index);
         return r.node->getData();
     }
+
+    /**
+     * Creates a read-only view over the nodes in [start, end) that can be used with std::ranges algorithms and
+     * std::views adaptors. Locating the start costs a single QuickSearch, iterating touches only the
+     * nodes inside the slice. The view is invalidated when one of its nodes is removed.
+     * @param start Index of the first node, clamped to 0
+     * @param end Index behind the last node, clamped to the size
+     * @return The view, empty if start >= end
+     */
+    Slice<T> slice(int64_t start, int64_t end) {
+        start = std::max<int64_t>(start, 0);
+        end = std::min(end, this->getSize());
+        if (start >= end)
+            return {};
+        if (reversed)
+            return {search(mirrorIndex(start)).node, end - start, true};
+        return {search(start).node, end - start};
+    }
+
+    /**
+     * @param index
+     * @return The index an element has after reversing the QuickList, -1 for -1
+     */
+    int64_t mirrorIndex(int64_t index) {
+        return index == -1 ? -1 : this->getMaxIndex() - index;
+    }
+
+    /**
+     * Reverses the order of the elements in O(1) by flipping the orientation of the QuickList. No node is
+     * touched: get, set, add, remove, their first/last variants, the operations on node handles and by value,
+     * slices, snapshots and saveTo translate between the reversed and the physical order. Walking the nodes
+     * directly through getFirstNode and getNextNode, as well as search and getNode, use the physical order.
+     */
+    void reverse() {
+        reversed = !reversed;
+    }
+
+    bool isReversed() {
+        return reversed;
+    }
+
+    /**
+     * Rotates the QuickList to the left, so that the element at index k becomes the first one. Negative
+     * values rotate to the right. Finds the pivot with one QuickSearch and relinks the sentinels in O(1).
+     * The JumpPointers of the longer part keep their nodes, as the origin of the grid is moved along with it,
+     * and only the shorter part that wraps around gets new ones. Costs O(√n + min(k, n - k)).
+     * Rotations are not recorded by the TraceRecorder.
+     * @param k
+     */
+    void rotate(int64_t k) {
+        int64_t size = this->getSize();
+        if (size < 2)
+            return;
+        k %= size;
+        if (k < 0)
+            k += size;
+        if (reversed)
+            k = (size - k) % size;
+        if (k == 0)
+            return;
+        cancelBackgroundRebuild();
+
+        searchResult r = search(k);
+        Node<T>* pivot = r.node;
+        Node<Node<T>*>* shifted = firstShiftedJumpPointer(k, r.jumpPointer);
+        Node<T>* first = this->getFirstNode();
+        Node<T>* last = this->getLastNode();
+        Node<T>* beforePivot = pivot->getPrevNode();
+        if (!snapshots.empty()) {
+            preserveForSnapshots(k - 1, true);
+            preserveForSnapshots(size - 1, true);
+            for (auto& segments : snapshots)
+                segments->rotate(k, size);
+        }
+
+        this->getHead()->setNextNode(pivot);
+        pivot->setPrevNode(this->getHead());
+        last->setNextNode(first);
+        first->setPrevNode(last);
+        beforePivot->setNextNode(this->getTail());
+        this->getTail()->setPrevNode(beforePivot);
+        forceInvalidateTrailingPointer();
+
+        if (k <= size - k) {
+            //[0, k) wraps around to the back
+            int64_t removed = 0;
+            for (; jumpList.getFirstNode() != shifted; removed++)
+                jumpList.removeFirst();
+            origin = (origin + k) % distance;
+            Node<T>* node = first;
+            for (int64_t index = size - k; index < size; index++, node = node->getNextNode())
+                if (indexHasJumpPointer(index))
+                    jumpList.append(node);
+
+            //Segments between two kept JumpPointers are unchanged, the first and the ones behind them are new
+            if (fingerprintHash != nullptr) {
+                int64_t keptSegments = std::max<int64_t>(0, (int64_t) fingerprints.size() - removed - 2);
+                fingerprints.erase(fingerprints.begin(), fingerprints.begin() + std::min<int64_t>(removed + 1, (int64_t) fingerprints.size()));
+                fingerprints.resize(keptSegments);
+                fingerprints.push_front(0);
+                fingerprints.resize(jumpList.getSize() + 1);
+                rehashSegments(0, 0);
+                rehashSegments(keptSegments + 1, jumpList.getSize());
+            }
+        } else {
+            //[k, n) wraps around to the front
+            Node<Node<T>*>* lastKept = shifted->getPrevNode();
+            while (jumpList.getLastNode() != lastKept)
+                jumpList.removeLast();
+            int64_t kept = jumpList.getSize();
+            origin = ((origin - (size - k)) % distance + distance) % distance;
+            Node<T>* node = last;
+            for (int64_t index = size - k - 1; index >= 0; index--, node = node->getPrevNode())
+                if (indexHasJumpPointer(index))
+                    jumpList.prepend(node);
+
+            //Segments between two kept JumpPointers are unchanged, the ones up to the first kept one and the last one are new
+            if (fingerprintHash != nullptr) {
+                int64_t prepended = jumpList.getSize() - kept;
+                fingerprints.resize(std::max<int64_t>(kept, 1));
+                fingerprints.pop_front();
+                fingerprints.insert(fingerprints.begin(), prepended + 1, 0);
+                fingerprints.resize(jumpList.getSize() + 1);
+                rehashSegments(0, prepended);
+                rehashSegments(jumpList.getSize(), jumpList.getSize());
+            }
+        }
+    }
 };
+
+/**
+ * QuickList whose nodes come from a std::pmr::memory_resource, e.g. a per-request monotonic arena
+ */
+template <typename T>
+using PmrQuickList = QuickList<T, std::pmr::polymorphic_allocator<T>>;
+
+#endif
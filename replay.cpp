@@ -0,0 +1,262 @@
+#include "quicklist.cpp"
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <list>
+#include <string>
+#include <vector>
+
+/**
+ * Replays a trace written by a TraceRecorder against QuickList, its configuration variants and std::list,
+ * reporting throughput and latency percentiles for each of them.
+ *
+ * Usage: QuickListReplay <trace file> [repetitions]
+ */
+
+std::vector<TraceRecorder::TraceEntry> loadTrace(const char* path, int64_t& initialSize) {
+    std::vector<TraceRecorder::TraceEntry> trace;
+    TraceReader reader;
+    if (!reader.open(path))
+        return trace;
+
+    initialSize = reader.getInitialSize();
+    TraceRecorder::TraceEntry entry;
+    while (reader.next(entry))
+        trace.push_back(entry);
+    return trace;
+}
+
+/**
+ * Adapts QuickList to the replay loop.
+ * Without TrailingPointer all fingers are invalidated before every operation, so that each
+ * search has to start from the JumpList.
+ */
+class QuickListTarget {
+public:
+    QuickList<int> list;
+    bool useTrailingPointer;
+
+    explicit QuickListTarget(bool trailingPointer) : useTrailingPointer(trailingPointer) {}
+
+    int64_t size() {
+        return list.getSize();
+    }
+
+    int64_t sum() {
+        int64_t sum = 0;
+        for (int x : list.slice(0, list.getSize()))
+            sum += x;
+        return sum;
+    }
+
+    int run(TraceRecorder::TraceEntry entry, int value) {
+        if (!useTrailingPointer)
+            list.forceInvalidateTrailingPointer();
+
+        switch (entry.op) {
+            case TraceRecorder::GET:
+                return list.get(entry.index);
+            case TraceRecorder::SET:
+                list.set(entry.index, value);
+                break;
+            case TraceRecorder::ADD:
+                list.add(entry.index, value);
+                break;
+            case TraceRecorder::REMOVE:
+                list.remove(entry.index);
+                break;
+            case TraceRecorder::APPEND:
+                list.append(value);
+                break;
+            case TraceRecorder::PREPEND:
+                list.prepend(value);
+                break;
+            case TraceRecorder::CLEAR:
+                list.clear();
+                break;
+        }
+        return 0;
+    }
+};
+
+/**
+ * Adapts std::list to the replay loop. Positions are reached from whichever end is nearer.
+ */
+class StdListTarget {
+public:
+    std::list<int> list;
+
+    int64_t size() {
+        return (int64_t) list.size();
+    }
+
+    int64_t sum() {
+        int64_t sum = 0;
+        for (int x : list)
+            sum += x;
+        return sum;
+    }
+
+    std::list<int>::iterator at(int64_t index) {
+        if (index < size() / 2)
+            return std::next(list.begin(), index);
+        return std::prev(list.end(), size() - index);
+    }
+
+    int run(TraceRecorder::TraceEntry entry, int value) {
+        switch (entry.op) {
+            case TraceRecorder::GET:
+                return *at(entry.index);
+            case TraceRecorder::SET:
+                *at(entry.index) = value;
+                break;
+            case TraceRecorder::ADD:
+                list.insert(at(entry.index), value);
+                break;
+            case TraceRecorder::REMOVE:
+                list.erase(at(entry.index));
+                break;
+            case TraceRecorder::APPEND:
+                list.push_back(value);
+                break;
+            case TraceRecorder::PREPEND:
+                list.push_front(value);
+                break;
+            case TraceRecorder::CLEAR:
+                list.clear();
+                break;
+        }
+        return 0;
+    }
+};
+
+/**
+ * Mirrors the range handling of QuickList so that all targets skip the same entries.
+ * @return True if the entry can be replayed on a list of the given size
+ */
+bool replayable(TraceRecorder::TraceEntry entry, int64_t size) {
+    switch (entry.op) {
+        case TraceRecorder::GET:
+        case TraceRecorder::SET:
+        case TraceRecorder::REMOVE:
+            return entry.index >= 0 && entry.index < size;
+        case TraceRecorder::ADD:
+            return entry.index > 0 && entry.index <= size - 1;
+        default:
+            return true;
+    }
+}
+
+typedef struct ReplayResult {
+    double opsPerSecond;
+    std::vector<int64_t> latencies;
+    //Sum of all values read by GET and of the final contents, equal for all targets that replayed correctly
+    int64_t checksum;
+} ReplayResult;
+
+template <typename Target>
+void prefill(Target& target, int64_t initialSize) {
+    TraceRecorder::TraceEntry entry {TraceRecorder::APPEND, 0};
+    for (int64_t i = 0; i < initialSize; i++)
+        target.run(entry, (int) i);
+}
+
+template <typename Target, typename... Args>
+ReplayResult replay(const std::vector<TraceRecorder::TraceEntry>& trace, int64_t initialSize,
+                    int repetitions, Args... args) {
+    ReplayResult result {0, {}, 0};
+    std::chrono::nanoseconds total {0};
+
+    for (int r = 0; r < repetitions; r++) {
+        //Throughput pass without per-operation timers
+        {
+            Target target(args...);
+            prefill(target, initialSize);
+            auto t1 = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < trace.size(); i++)
+                if (replayable(trace[i], target.size()))
+                    result.checksum += target.run(trace[i], (int) i);
+            total += std::chrono::steady_clock::now() - t1;
+            result.checksum += target.sum();
+        }
+
+        //Latency pass
+        {
+            Target target(args...);
+            prefill(target, initialSize);
+            for (size_t i = 0; i < trace.size(); i++) {
+                if (!replayable(trace[i], target.size()))
+                    continue;
+                auto t1 = std::chrono::steady_clock::now();
+                target.run(trace[i], (int) i);
+                auto t2 = std::chrono::steady_clock::now();
+                result.latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(t2 - t1).count());
+            }
+        }
+    }
+
+    std::sort(result.latencies.begin(), result.latencies.end());
+    double seconds = std::chrono::duration<double>(total).count();
+    result.opsPerSecond = seconds > 0 ? (double) result.latencies.size() / seconds : 0;
+    return result;
+}
+
+int64_t percentile(const std::vector<int64_t>& sorted, double p) {
+    if (sorted.empty())
+        return 0;
+    return sorted[std::min(sorted.size() - 1, (size_t) (p / 100 * (double) sorted.size()))];
+}
+
+void report(const std::string& name, const ReplayResult& result) {
+    std::cout << std::left << std::setw(28) << name << std::right
+    << std::setw(14) << (int64_t) result.opsPerSecond
+    << std::setw(10) << percentile(result.latencies, 50)
+    << std::setw(10) << percentile(result.latencies, 90)
+    << std::setw(10) << percentile(result.latencies, 99)
+    << std::setw(10) << percentile(result.latencies, 99.9)
+    << std::setw(12) << (result.latencies.empty() ? 0 : result.latencies.back())
+    << std::setw(22) << result.checksum
+    << "\n";
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cout << "Usage: " << argv[0] << " <trace file> [repetitions]\n";
+        return 1;
+    }
+
+    int64_t initialSize = 0;
+    std::vector<TraceRecorder::TraceEntry> trace = loadTrace(argv[1], initialSize);
+    if (trace.empty()) {
+        std::cout << "Could not read any operations from " << argv[1] << "\n";
+        return 1;
+    }
+    int repetitions = argc > 2 ? std::max(1, std::stoi(argv[2])) : 1;
+
+    std::cout << trace.size() << " operations, initial size " << initialSize
+    << ", " << repetitions << " repetition(s)\n\n";
+    std::cout << std::left << std::setw(28) << "Target" << std::right
+    << std::setw(14) << "ops/s"
+    << std::setw(10) << "p50 ns"
+    << std::setw(10) << "p90 ns"
+    << std::setw(10) << "p99 ns"
+    << std::setw(10) << "p99.9 ns"
+    << std::setw(12) << "max ns"
+    << std::setw(22) << "checksum" << "\n";
+
+    ReplayResult results[] = {
+            replay<QuickListTarget>(trace, initialSize, repetitions, true),
+            replay<QuickListTarget>(trace, initialSize, repetitions, false),
+            replay<StdListTarget>(trace, initialSize, repetitions)};
+    report("QuickList", results[0]);
+    report("QuickList (no Trailing)", results[1]);
+    report("std::list", results[2]);
+
+    for (const ReplayResult& result : results) {
+        if (result.checksum != results[2].checksum) {
+            std::cout << "\nChecksums differ, the targets did not replay the trace identically\n";
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <streambuf>
+#include <type_traits>
+#include <unistd.h>
+
+/**
+ * Writes and reads single elements of a QuickList snapshot. The default Serializer copies the raw bytes
+ * of an element and therefore only supports trivially copyable types. Specialise it, or pass your own
+ * class with the same two static methods to saveTo/loadFrom, to snapshot any other type.
+ */
+template <typename T>
+struct Serializer {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "The default Serializer only supports trivially copyable types, provide your own Serializer");
+
+    //Allows QuickList to read and write whole blocks of elements at once
+    static constexpr bool rawBytes = true;
+
+    static void write(std::ostream& out, const T& data) {
+        out.write(reinterpret_cast<const char*>(&data), sizeof(T));
+    }
+
+    static bool read(std::istream& in, T& data) {
+        return (bool) in.read(reinterpret_cast<char*>(&data), sizeof(T));
+    }
+};
+
+/**
+ * Minimal buffered stream buffer on top of a POSIX file descriptor, so that snapshots can be written
+ * to and read from sockets, pipes and already opened files. The descriptor is not closed, and reading
+ * leaves it right behind the last byte taken from the stream: bytes read ahead from a file are given
+ * back by seeking, and pipes and sockets are read without read-ahead.
+ */
+class FdStreamBuf : public std::streambuf {
+public:
+    int fd;
+    //False for pipes and sockets, which cannot give back bytes that have been read ahead
+    bool seekable;
+    char buffer[1 << 16];
+
+    explicit FdStreamBuf(int fileDescriptor) : fd(fileDescriptor), seekable(::lseek(fileDescriptor, 0, SEEK_CUR) != -1) {
+        setp(buffer, buffer + sizeof(buffer));
+        setg(buffer, buffer, buffer);
+    }
+
+    ~FdStreamBuf() override {
+        sync();
+        unread();
+    }
+
+    /**
+     * Seeks the descriptor back over the bytes that have been read ahead but not taken from the stream
+     * @return False if seeking failed
+     */
+    bool unread() {
+        off_t ahead = egptr() - gptr();
+        setg(buffer, buffer, buffer);
+        return ahead == 0 || ::lseek(fd, -ahead, SEEK_CUR) != -1;
+    }
+
+    /**
+     * Writes the whole range to the descriptor, retrying on short writes.
+     * @return False on error
+     */
+    bool writeAll(const char* data, std::streamsize count) {
+        while (count > 0) {
+            ssize_t written = ::write(fd, data, count);
+            if (written <= 0)
+                return false;
+            data += written;
+            count -= written;
+        }
+        return true;
+    }
+
+    int sync() override {
+        bool ok = writeAll(pbase(), pptr() - pbase());
+        setp(buffer, buffer + sizeof(buffer));
+        return ok ? 0 : -1;
+    }
+
+    int_type overflow(int_type c) override {
+        if (sync() != 0)
+            return traits_type::eof();
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(c);
+            pbump(1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* data, std::streamsize count) override {
+        //Large blocks bypass the buffer
+        if (count >= (std::streamsize) sizeof(buffer)) {
+            if (sync() != 0 || !writeAll(data, count))
+                return 0;
+            return count;
+        }
+        return std::streambuf::xsputn(data, count);
+    }
+
+    int_type underflow() override {
+        ssize_t count = ::read(fd, buffer, seekable ? sizeof(buffer) : 1);
+        if (count <= 0)
+            return traits_type::eof();
+        setg(buffer, buffer, buffer + count);
+        return traits_type::to_int_type(*gptr());
+    }
+
+    std::streamsize xsgetn(char* data, std::streamsize count) override {
+        if (seekable)
+            return std::streambuf::xsgetn(data, count);
+        //Reads exactly the requested bytes, so that nothing behind them is consumed
+        std::streamsize done = std::min<std::streamsize>(count, egptr() - gptr());
+        std::copy(gptr(), gptr() + done, data);
+        gbump((int) done);
+        while (done < count) {
+            ssize_t received = ::read(fd, data + done, count - done);
+            if (received <= 0)
+                break;
+            done += received;
+        }
+        return done;
+    }
+};
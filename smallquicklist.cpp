@@ -0,0 +1,174 @@
+#include "quicklist.cpp"
+
+/**
+ * A QuickList that stores up to N elements inline in the object, without any heap allocation and without
+ * a JumpList. It switches to a heap allocated QuickList once it grows past N elements and back to the
+ * inline storage once it has shrunk to N / 2 elements, so that a size oscillating around N does not
+ * allocate on every operation. Meant for large numbers of tiny lists, e.g. per-key buckets.
+ * @tparam T Has to be default constructible
+ * @tparam N Number of inline elements
+ */
+template <typename T, int N = 8>
+class SmallQuickList {
+public:
+    static_assert(N > 0, "SmallQuickList needs room for at least one inline element");
+
+    //Inline elements, only used while list is nullptr
+    T elements[N];
+    int smallSize = 0;
+
+    //Node based representation, allocated once the list grows past N elements
+    std::unique_ptr<QuickList<T>> list;
+
+    SmallQuickList() = default;
+
+    SmallQuickList(const SmallQuickList& other) : smallSize(other.smallSize) {
+        std::copy(other.elements, other.elements + other.smallSize, elements);
+        if (other.list != nullptr)
+            list = std::make_unique<QuickList<T>>(*other.list);
+    }
+
+    SmallQuickList(SmallQuickList&& other) : smallSize(other.smallSize), list(std::move(other.list)) {
+        std::move(other.elements, other.elements + other.smallSize, elements);
+        other.smallSize = 0;
+    }
+
+    SmallQuickList& operator=(const SmallQuickList& other) {
+        if (this != &other) {
+            clear();
+            smallSize = other.smallSize;
+            std::copy(other.elements, other.elements + other.smallSize, elements);
+            if (other.list != nullptr)
+                list = std::make_unique<QuickList<T>>(*other.list);
+        }
+        return *this;
+    }
+
+    SmallQuickList& operator=(SmallQuickList&& other) {
+        if (this != &other) {
+            clear();
+            smallSize = other.smallSize;
+            std::move(other.elements, other.elements + other.smallSize, elements);
+            list = std::move(other.list);
+            other.smallSize = 0;
+        }
+        return *this;
+    }
+
+    bool isInline() {
+        return list == nullptr;
+    }
+
+    int64_t getSize() {
+        return isInline() ? smallSize : list->getSize();
+    }
+
+    int64_t getMaxIndex() {
+        return getSize() - 1;
+    }
+
+    bool isEmpty() {
+        return getSize() == 0;
+    }
+
+    /**
+     * Moves the inline elements into a new QuickList
+     */
+    void grow() {
+        list = std::make_unique<QuickList<T>>();
+        for (int i = 0; i < smallSize; i++)
+            list->append(std::move(elements[i]));
+        smallSize = 0;
+    }
+
+    /**
+     * Moves the elements back inline and frees the QuickList if it has shrunk far enough
+     */
+    void shrinkCheck() {
+        if (list == nullptr || list->getSize() > N / 2)
+            return;
+
+        Node<T>* node = list->getFirstNode();
+        while (list->hasNext(node)) {
+            elements[smallSize++] = std::move(node->data);
+            node = node->getNextNode();
+        }
+        list.reset();
+    }
+
+    T get(int64_t index) {
+        return isInline() ? elements[index] : list->get(index);
+    }
+
+    T getFirst() {
+        return get(0);
+    }
+
+    T getLast() {
+        return get(getMaxIndex());
+    }
+
+    void set(int64_t index, T data) {
+        if (isInline())
+            elements[index] = data;
+        else
+            list->set(index, data);
+    }
+
+    /**
+     * Adds an element at the given index, or appends/prepends it if the index is out of range like QuickList::add does.
+     * @param index
+     * @param data
+     */
+    void add(int64_t index, T data) {
+        if (isInline() && smallSize == N)
+            grow();
+        if (!isInline()) {
+            list->add(index, data);
+            return;
+        }
+
+        index = std::clamp<int64_t>(index, 0, smallSize);
+        std::move_backward(elements + index, elements + smallSize, elements + smallSize + 1);
+        elements[index] = data;
+        smallSize++;
+    }
+
+    void append(T data) {
+        add(getSize(), data);
+    }
+
+    void prepend(T data) {
+        add(0, data);
+    }
+
+    /**
+     * Removes the element at the given index. Out of range indices are ignored.
+     * @param index
+     */
+    void remove(int64_t index) {
+        if (index < 0 || index > getMaxIndex())
+            return;
+        if (!isInline()) {
+            list->remove(index);
+            shrinkCheck();
+            return;
+        }
+
+        std::move(elements + index + 1, elements + smallSize, elements + index);
+        smallSize--;
+    }
+
+    void removeFirst() {
+        remove(0);
+    }
+
+    void removeLast() {
+        remove(getMaxIndex());
+    }
+
+    void clear() {
+        list.reset();
+        smallSize = 0;
+    }
+};
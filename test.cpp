@@ -1,7 +1,36 @@
 #include "quicklist.cpp"
+#include "persistentquicklist.cpp"
+#include "compactquicklist.cpp"
+#include "smallquicklist.cpp"
+#include "indexedmap.cpp"
 #include "fstream"
+#include <atomic>
 #include <chrono>
 #include <thread>
+#include <sstream>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory_resource>
+
+/**
+ * Checks that every JumpPointer points to the node at its expected index and that no JumpPointer is missing
+ * @return True if the JumpList matches the QuickList
+ */
+template <typename T, typename Allocator>
+bool jumpListConsistent(QuickList<T, Allocator>& q) {
+    Node<Node<T>*>* jumpPointer = q.jumpList.getFirstNode();
+    Node<T>* node = q.getFirstNode();
+    for (int index = 0; q.hasNext(node); index++, node = node->getNextNode()) {
+        if (!q.indexHasJumpPointer(index))
+            continue;
+        if (!q.jumpList.hasNext(jumpPointer) || jumpPointer->getData() != node)
+            return false;
+        jumpPointer = jumpPointer->getNextNode();
+    }
+    return jumpPointer == q.jumpList.getTail();
+}
 
 void testAllSearchTypes() {
     QuickList<int> q;
@@ -38,7 +67,7 @@ void testAllSearchTypes() {
 
 bool testQuickSearchPerformance() {
     std::cout << "\nTesting QuickSearch speed...\n";
-    std::cout << "TrailingPointer is force-invalidated after every subroutine.\n";
+    std::cout << "Fingers are force-invalidated after every subroutine.\n";
 
     auto* q = new QuickList<int>;
 
@@ -105,8 +134,8 @@ bool testQuickSearchAccuracy() {
 
     for (int i = 0; i < 25000; i++) {
         q.search(500000 + i);
-        if (q.trailingPointer.index != 500000 + i ||
-        q.trailingPointer.node->getData() != 500000 + i) {
+        if (q.trailingPointer().index != 500000 + i ||
+        q.trailingPointer().node->getData() != 500000 + i) {
             std::cout << "Constant access (next) error at i = " << i << "\n";
             q.forceInvalidateTrailingPointer();
             success = false;
@@ -116,8 +145,8 @@ bool testQuickSearchAccuracy() {
 
     for (int i = 0; i < 25000; i++) {
         q.search(524999 - i);
-        if (q.trailingPointer.index != 524999 - i ||
-        q.trailingPointer.node->getData() != 524999 - i) {
+        if (q.trailingPointer().index != 524999 - i ||
+        q.trailingPointer().node->getData() != 524999 - i) {
             std::cout << "Constant access (prev) error at i = " << i << "\n";
             q.forceInvalidateTrailingPointer();
             success = false;
@@ -127,8 +156,8 @@ bool testQuickSearchAccuracy() {
 
     for (int i = 0; i < 50000; i++) {
         q.search(100000 + ((i % 1250) * 640));
-        if (q.trailingPointer.index != 100000 + ((i % 1250) * 640) ||
-        q.trailingPointer.node->getData() != 100000 + ((i % 1250) * 640)) {
+        if (q.trailingPointer().index != 100000 + ((i % 1250) * 640) ||
+        q.trailingPointer().node->getData() != 100000 + ((i % 1250) * 640)) {
             std::cout << "Trailing access error at i = " << i << "\n";
             q.forceInvalidateTrailingPointer();
             success = false;
@@ -140,8 +169,8 @@ bool testQuickSearchAccuracy() {
     for (int i = 0; i < 50000; i++) {
         r = random() % 1000000;
         q.search(r);
-        if (q.trailingPointer.index != r  ||
-        q.trailingPointer.node->getData() != r) {
+        if (q.trailingPointer().index != r  ||
+        q.trailingPointer().node->getData() != r) {
             std::cout << "Random access error at i = " << i << "\n";
             success = false;
             continue;
@@ -234,6 +263,487 @@ bool testPrepend() {
     return success;
 }
 
+bool testTraceRecording() {
+    QuickList<int> q;
+    TraceRecorder recorder;
+    bool success = true;
+    std::cout << "\nTesting QuickList trace recording...\n";
+
+    for (int i = 0; i < 300; ++i)
+        q.append(i);
+
+    recorder.open("trace_test.bin", q.getSize());
+    q.setRecorder(&recorder);
+    q.get(150);
+    q.set(100, 7);
+    q.add(42, 1);
+    q.add(0, 2);
+    q.remove(299);
+    q.append(3);
+    q.prepend(4);
+    q.setRecorder(nullptr);
+    q.get(5);
+    recorder.close();
+    if (!jumpListConsistent(q)) {
+        std::cout << "JumpList inconsistent after the recorded operations\n";
+        success = false;
+    }
+
+    TraceRecorder::TraceEntry expected[] = {
+            {TraceRecorder::GET, 150},
+            {TraceRecorder::SET, 100},
+            {TraceRecorder::ADD, 42},
+            {TraceRecorder::PREPEND, 0},
+            {TraceRecorder::REMOVE, 299},
+            {TraceRecorder::APPEND, 301},
+            {TraceRecorder::PREPEND, 0}
+    };
+
+    TraceReader reader;
+    TraceRecorder::TraceEntry entry;
+    if (!reader.open("trace_test.bin") || reader.getInitialSize() != 300) {
+        std::cout << "Trace header error\n";
+        success = false;
+    }
+    for (int i = 0; success && i < 7; ++i) {
+        if (!reader.next(entry) || entry.op != expected[i].op || entry.index != expected[i].index) {
+            std::cout << "Trace entry error at entry " << i << "\n";
+            success = false;
+        }
+    }
+    if (success && reader.next(entry)) {
+        std::cout << "Trace contains operations recorded after detaching\n";
+        success = false;
+    }
+
+    //Every operation that changes the size is recorded, so replaying the trace tracks the size exactly
+    recorder.open("trace_test.bin", q.getSize());
+    q.setRecorder(&recorder);
+    q.removeFirst();
+    q.removeLast();
+    q.eraseAt(q.getFirstNode());
+    q.removeRange(10, 19);
+    q.removeIf([](int x) { return x % 3 == 0; });
+    q.clear();
+    int elements[] = {1, 2, 3, 4, 5};
+    q.assign(elements);
+    q.reverse();
+    q.removeFirst();
+    q.remove(1);
+    q.setRecorder(nullptr);
+    recorder.close();
+
+    TraceReader replay;
+    int64_t size = -1;
+    bool inRange = replay.open("trace_test.bin");
+    if (inRange)
+        size = replay.getInitialSize();
+    while (inRange && replay.next(entry)) {
+        if (entry.op == TraceRecorder::REMOVE) {
+            inRange = entry.index >= 0 && entry.index < size;
+            size--;
+        } else if (entry.op == TraceRecorder::CLEAR) {
+            size = 0;
+        } else if (entry.op != TraceRecorder::GET && entry.op != TraceRecorder::SET) {
+            size++;
+        }
+    }
+    if (!inRange || size != q.getSize()) {
+        std::cout << "Replayed size " << size << " differs from the recorded QuickList's " << q.getSize() << "\n";
+        success = false;
+    }
+
+    if (success)
+        std::cout << "QuickList trace recording test successful.\n";
+    else
+        std::cout << "QuickList trace recording test failed.\n";
+    return success;
+}
+
+struct StringSerializer {
+    static void write(std::ostream& out, const std::string& data) {
+        uint32_t length = data.size();
+        out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        out.write(data.data(), length);
+    }
+
+    static bool read(std::istream& in, std::string& data) {
+        uint32_t length;
+        if (!in.read(reinterpret_cast<char*>(&length), sizeof(length)))
+            return false;
+        data.resize(length);
+        return (bool) in.read(data.data(), length);
+    }
+};
+
+struct ElementwiseSerializer : Serializer<int> {
+    static constexpr bool rawBytes = false;
+};
+
+bool testSnapshot() {
+    QuickList<int> q;
+    bool success = true;
+    std::cout << "\nTesting QuickList save and load...\n";
+
+    for (int i = 0; i < 100000; ++i)
+        q.append(i);
+
+    std::stringstream stream;
+    QuickList<int> loaded;
+    loaded.append(-1);
+    if (!q.saveTo(stream) || !loaded.loadFrom(stream)) {
+        std::cout << "Stream snapshot could not be saved or loaded\n";
+        success = false;
+    }
+    if (loaded.getSize() != 100000 || loaded.distance != q.distance || !jumpListConsistent(loaded)) {
+        std::cout << "Loaded QuickList has size " << loaded.getSize() << " and distance " << loaded.distance << "\n";
+        success = false;
+    }
+    for (int i = 0; success && i < 100000; i += 997) {
+        if (loaded.get(i) != i) {
+            std::cout << "Snapshot error at index " << i << "\n";
+            success = false;
+        }
+    }
+
+    //Two snapshots and a trailer in one file, each load has to stop right behind its snapshot
+    FILE* file = tmpfile();
+    int fd = fileno(file);
+    QuickList<int> fromFd;
+    QuickList<int> small;
+    for (int i = 0; i < 10; ++i)
+        small.append(i);
+    char trailer = 0;
+    if (!q.saveTo(fd) || !small.saveTo(fd) || write(fd, "!", 1) != 1 || lseek(fd, 0, SEEK_SET) != 0 ||
+    !fromFd.loadFrom(fd) || fromFd.getLast() != 99999 || !fromFd.loadFrom(fd) || fromFd.getSize() != 10 ||
+    read(fd, &trailer, 1) != 1 || trailer != '!') {
+        std::cout << "File descriptor snapshot error\n";
+        success = false;
+    }
+    fclose(file);
+
+    int pipeFds[2];
+    trailer = 0;
+    if (pipe(pipeFds) != 0 || !small.saveTo(pipeFds[1]) || write(pipeFds[1], "?", 1) != 1 ||
+    !fromFd.loadFrom(pipeFds[0]) || fromFd.getLast() != 9 || read(pipeFds[0], &trailer, 1) != 1 || trailer != '?') {
+        std::cout << "Pipe snapshot error\n";
+        success = false;
+    }
+    close(pipeFds[0]);
+    close(pipeFds[1]);
+
+    //A Serializer that opts out of raw blocks writes its elements one by one, which a raw load rejects
+    stream.str("");
+    if (!small.saveTo<ElementwiseSerializer>(stream) || loaded.loadFrom(stream)) {
+        std::cout << "rawBytes = false has been ignored\n";
+        success = false;
+    }
+
+    QuickList<std::string> strings;
+    QuickList<std::string> loadedStrings;
+    for (int i = 0; i < 500; ++i)
+        strings.append(std::to_string(i));
+    stream.str("");
+    if (!strings.saveTo<StringSerializer>(stream) || !loadedStrings.loadFrom<StringSerializer>(stream) ||
+    loadedStrings.getSize() != 500 || loadedStrings.get(321) != "321") {
+        std::cout << "Custom Serializer snapshot error\n";
+        success = false;
+    }
+
+    std::stringstream truncated(stream.str().substr(0, 100));
+    if (loadedStrings.loadFrom<StringSerializer>(truncated) || !loadedStrings.isEmpty()) {
+        std::cout << "Truncated snapshot has not been rejected\n";
+        success = false;
+    }
+
+    if (success)
+        std::cout << "QuickList save/load test successful.\n";
+    else
+        std::cout << "QuickList save/load test failed.\n";
+    return success;
+}
+
+template <typename Offset>
+bool testPersistentQuickList(const char* path) {
+    bool success = true;
+    std::vector<int> reference;
+    std::remove(path);
+
+    {
+        PersistentQuickList<int, Offset> p;
+        if (!p.open(path)) {
+            std::cout << "Persistent QuickList could not be created\n";
+            return false;
+        }
+        for (int i = 0; i < 20000; ++i) {
+            p.append(i);
+            reference.push_back(i);
+        }
+        for (int i = 0; i < 2000; ++i) {
+            int index = random() % (int) reference.size();
+            if (i % 3 == 0) {
+                p.remove(index);
+                reference.erase(reference.begin() + index);
+            } else {
+                p.add(index, -i);
+                reference.insert(reference.begin() + index, -i);
+            }
+        }
+        p.prepend(-1);
+        reference.insert(reference.begin(), -1);
+        p.set(777, 123456);
+        reference[777] = 123456;
+        if (!p.flush()) {
+            std::cout << "Persistent QuickList could not be flushed\n";
+            success = false;
+        }
+    }
+
+    PersistentQuickList<int, Offset> reopened;
+    if (!reopened.open(path, true) || reopened.getSize() != (int64_t) reference.size()) {
+        std::cout << "Persistent QuickList could not be reopened\n";
+        return false;
+    }
+    for (int i = 0; i < (int) reference.size(); ++i) {
+        if (reopened.get(i) != reference[i]) {
+            std::cout << "Persistent QuickList error at index " << i << "\n";
+            success = false;
+            break;
+        }
+    }
+    reopened.append(5);
+    if (reopened.getSize() != (int64_t) reference.size()) {
+        std::cout << "Read-only Persistent QuickList has been modified\n";
+        success = false;
+    }
+    reopened.close();
+
+    //A reader follows the writer when it grows the file beyond the reader's mapping
+    PersistentQuickList<int, Offset> writer;
+    PersistentQuickList<int, Offset> reader;
+    if (!writer.open(path) || !reader.open(path, true)) {
+        std::cout << "Persistent QuickList could not be opened by a writer and a reader\n";
+        return false;
+    }
+    size_t mapped = reader.region.length;
+    for (int i = 0; i < 100000; ++i)
+        writer.append(i);
+    if (reader.getLast() != 99999 || reader.get(reader.getSize() / 2) != writer.get(writer.getSize() / 2) ||
+    reader.region.length <= mapped) {
+        std::cout << "Read-only Persistent QuickList did not follow the growing file\n";
+        success = false;
+    }
+    reader.close();
+    writer.close();
+
+    PersistentQuickList<double, Offset> mismatch;
+    if (mismatch.open(path)) {
+        std::cout << "Persistent QuickList of a different element type has been opened\n";
+        success = false;
+    }
+    std::remove(path);
+    return success;
+}
+
+bool testPersistentQuickLists() {
+    std::cout << "\nTesting Persistent QuickList...\n";
+    bool success = testPersistentQuickList<uint64_t>("persistent_test.qlist") &&
+            testPersistentQuickList<uint32_t>("persistent_test32.qlist");
+
+    if (success)
+        std::cout << "Persistent QuickList test successful.\n";
+    else
+        std::cout << "Persistent QuickList test failed.\n";
+    return success;
+}
+
+bool testCompactQuickList() {
+    bool success = true;
+    std::vector<int> reference;
+    CompactQuickList<int> c;
+    std::cout << "\nTesting Compact QuickList...\n";
+
+    if (sizeof(CompactQuickList<int>::Slot) != 12) {
+        std::cout << "Compact node takes " << sizeof(CompactQuickList<int>::Slot) << " bytes\n";
+        success = false;
+    }
+
+    for (int i = 0; i < 50000; ++i) {
+        c.append(i);
+        reference.push_back(i);
+    }
+    for (int i = 0; i < 5000; ++i) {
+        int index = random() % (int) reference.size();
+        if (i % 2 == 0) {
+            c.remove(index);
+            reference.erase(reference.begin() + index);
+        } else {
+            c.add(index, -i);
+            reference.insert(reference.begin() + index, -i);
+        }
+    }
+    for (int i = 0; i < 10000; ++i) {
+        c.removeFirst();
+        reference.erase(reference.begin());
+    }
+
+    CompactQuickList<int> copy(c);
+    copy.set(0, -5);
+    for (int i = 0; i < (int) reference.size(); ++i) {
+        if (c.get(i) != reference[i] || (i > 0 && copy.get(i) != reference[i])) {
+            std::cout << "Compact QuickList error at index " << i << "\n";
+            success = false;
+            break;
+        }
+    }
+    if (c.getSize() != (int64_t) reference.size() || c.getFirst() == -5) {
+        std::cout << "Compact QuickList copy is not independent\n";
+        success = false;
+    }
+
+    if (success)
+        std::cout << "Compact QuickList test successful.\n";
+    else
+        std::cout << "Compact QuickList test failed.\n";
+    return success;
+}
+
+QuickList<int> makeQuickList(int size) {
+    QuickList<int> q;
+    for (int i = 0; i < size; ++i)
+        q.append(i);
+    return q;
+}
+
+bool testCopyAndMove() {
+    bool success = true;
+    std::cout << "\nTesting QuickList copy and move...\n";
+
+    QuickList<int> original = makeQuickList(100000);
+    QuickList<int> copy(original);
+    copy.set(500, -1);
+    if (copy.getSize() != 100000 || copy.distance != original.distance || !jumpListConsistent(copy) ||
+    original.get(500) != 500 || copy.get(500) != -1 || copy.get(99999) != 99999) {
+        std::cout << "Copy constructor error\n";
+        success = false;
+    }
+
+    QuickList<int> moved(std::move(copy));
+    if (moved.getSize() != 100000 || moved.get(500) != -1 || !jumpListConsistent(moved) ||
+    !copy.isEmpty() || !jumpListConsistent(copy)) {
+        std::cout << "Move constructor error\n";
+        success = false;
+    }
+    copy.append(1);
+    if (copy.get(0) != 1) {
+        std::cout << "Moved-from QuickList is not usable\n";
+        success = false;
+    }
+
+    QuickList<int> assigned = makeQuickList(10);
+    assigned = original;
+    if (assigned.getSize() != 100000 || assigned.get(77777) != 77777 || !jumpListConsistent(assigned)) {
+        std::cout << "Copy assignment error\n";
+        success = false;
+    }
+    assigned = makeQuickList(300);
+    if (assigned.getSize() != 300 || assigned.get(250) != 250 || !jumpListConsistent(assigned)) {
+        std::cout << "Move assignment error\n";
+        success = false;
+    }
+
+    if (success)
+        std::cout << "QuickList copy and move test successful.\n";
+    else
+        std::cout << "QuickList copy and move test failed.\n";
+    return success;
+}
+
+/**
+ * Checks that every valid finger points to the node at its index and to the JumpPointer at or below it
+ */
+template <typename T>
+bool trailingPointerConsistent(QuickList<T>& q) {
+    for (auto& finger : q.fingers) {
+        if (finger.index == -1)
+            continue;
+        if (finger.index < 0 || finger.index > q.getMaxIndex() ||
+        q.getNode(finger.index) != finger.node ||
+        q.jumpPointerAt(q.getJumpOrdinal(finger.index)) != finger.jumpPointer)
+            return false;
+    }
+    return true;
+}
+
+bool testDequeOperations() {
+    QuickList<int> q;
+    BaseList<int>& base = q;
+    std::deque<int> reference;
+    bool success = true;
+    std::cout << "\nTesting QuickList deque operations...\n";
+
+    for (int i = 0; i < 5000; ++i) {
+        q.append(i);
+        reference.push_back(i);
+    }
+
+    for (int i = 0; success && i < 200000; ++i) {
+        int operation = random() % 10;
+        int index = reference.empty() ? 0 : random() % (int) reference.size();
+        if (operation < 3) {
+            q.prepend(i);
+            reference.push_front(i);
+        } else if (operation < 5) {
+            q.removeFirst();
+            if (!reference.empty())
+                reference.pop_front();
+        } else if (operation == 5) {
+            base.removeFirst();
+            if (!reference.empty())
+                reference.pop_front();
+        } else if (operation == 6) {
+            q.append(i);
+            reference.push_back(i);
+        } else if (operation == 7 && !reference.empty()) {
+            q.remove(index);
+            reference.erase(reference.begin() + index);
+        } else if (operation == 8) {
+            q.add(index, i);
+            reference.insert(reference.begin() + index, i);
+        } else if (!reference.empty() && q.get(index) != reference[index]) {
+            std::cout << "Deque operation error at index " << index << " after " << i << " operations\n";
+            success = false;
+        }
+
+        if (i % 997 == 0 && (!jumpListConsistent(q) || !trailingPointerConsistent(q) ||
+        q.getSize() != (int) reference.size())) {
+            std::cout << "JumpList or TrailingPointer inconsistent after " << i << " operations\n";
+            success = false;
+        }
+    }
+
+    QuickList<int> large = makeQuickList(1000000);
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < 100000; ++i) {
+        large.prepend(i);
+        large.removeFirst();
+        large.removeFirst();
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "\t" << duration_cast<std::chrono::microseconds>(t2 - t1).count()
+    << "µs for 100.000 prepend and 200.000 removeFirst calls on 1.000.000 nodes\n";
+    if (!jumpListConsistent(large) || large.get(450000) != 550000) {
+        std::cout << "Deque operations on a large QuickList error\n";
+        success = false;
+    }
+
+    if (success)
+        std::cout << "QuickList deque operations test successful.\n";
+    else
+        std::cout << "QuickList deque operations test failed.\n";
+    return success;
+}
+
 void testRegularSearch() {
     QuickList<int> q;
 
@@ -254,8 +764,1448 @@ void testTrailingSearch() {
     q.search(145);
 }
 
+bool testHandles() {
+    QuickList<int> q;
+    std::vector<Node<int>*> handles;
+    std::vector<int> reference;
+    bool success = true;
+    std::cout << "\nTesting QuickList node handles...\n";
+
+    for (int i = 0; i < 3000; ++i) {
+        handles.push_back(q.append(i));
+        reference.push_back(i);
+    }
+
+    for (int i = 0; success && i < 20000; ++i) {
+        int operation = random() % 4;
+        int index = random() % (int) reference.size();
+        if (operation == 0) {
+            Node<int>* handle = q.insertBefore(handles[index], -i - 1);
+            handles.insert(handles.begin() + index, handle);
+            reference.insert(reference.begin() + index, -i - 1);
+        } else if (operation == 1 && reference.size() > 1) {
+            Node<int>* next = q.eraseAt(handles[index]);
+            handles.erase(handles.begin() + index);
+            reference.erase(reference.begin() + index);
+            if (index < (int) handles.size() ? next != handles[index] : next != q.getTail()) {
+                std::cout << "eraseAt returned the wrong node at index " << index << "\n";
+                success = false;
+            }
+        } else if (q.indexOf(handles[index]) != index || handles[index]->getData() != reference[index]) {
+            std::cout << "Handle of index " << index << " reported index " << q.indexOf(handles[index]) << "\n";
+            success = false;
+        }
+
+        if (i % 499 == 0 && (!jumpListConsistent(q) || !trailingPointerConsistent(q))) {
+            std::cout << "JumpList or TrailingPointer inconsistent after " << i << " operations\n";
+            success = false;
+        }
+    }
+
+    //Removals through BaseList have to keep the JumpList intact as well
+    q.removeFirstOccurrence(reference[reference.size() / 2]);
+    reference.erase(reference.begin() + (int) reference.size() / 2);
+    for (int i = 0; success && i < (int) reference.size(); i += 7)
+        success = q.get(i) == reference[i];
+    if (!success || !jumpListConsistent(q)) {
+        std::cout << "Handles error after removeFirstOccurrence\n";
+        success = false;
+    }
+
+    //Nodes of another QuickList are rejected without touching this one
+    QuickList<int> other;
+    for (int i = 0; i < 100; ++i)
+        other.append(i);
+    Node<int>* foreign = other.getNode(50);
+    int64_t size = q.getSize();
+    if (q.insertBefore(foreign, 1) != nullptr || q.eraseAt(foreign) != nullptr || q.indexOf(foreign) != -1 ||
+    q.getSize() != size || other.getSize() != 100 || !jumpListConsistent(q) || !jumpListConsistent(other)) {
+        std::cout << "Foreign node has not been rejected\n";
+        success = false;
+    }
+
+    if (success)
+        std::cout << "QuickList node handles test successful.\n";
+    else
+        std::cout << "QuickList node handles test failed.\n";
+    return success;
+}
+
+bool testSlice() {
+    static_assert(std::ranges::view<Slice<int>>);
+    static_assert(std::ranges::forward_range<Slice<int>>);
+    static_assert(std::ranges::sized_range<Slice<int>>);
+
+    QuickList<int> q = makeQuickList(1000000);
+    bool success = true;
+    std::cout << "\nTesting QuickList slices...\n";
+
+    auto t1 = std::chrono::high_resolution_clock::now();
+    auto pipeline = q.slice(400000, 500000)
+                    | std::views::filter([](int x) { return x % 2 == 0; })
+                    | std::views::transform([](int x) { return (int64_t) x * 3; })
+                    | std::views::take(20000);
+    int64_t sum = 0;
+    for (int64_t x : pipeline)
+        sum += x;
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "\t" << duration_cast<std::chrono::microseconds>(t2 - t1).count()
+    << "µs for a filter/transform/take pipeline over 100.000 of 1.000.000 nodes\n";
+
+    int64_t expected = 0;
+    for (int64_t x = 400000; x < 440000; x += 2)
+        expected += x * 3;
+    if (sum != expected) {
+        std::cout << "Slice pipeline error: " << sum << " instead of " << expected << "\n";
+        success = false;
+    }
+
+    Slice<int> tail = q.slice(999990, 2000000);
+    if (tail.size() != 10 || tail.front() != 999990 || std::ranges::max(tail) != 999999) {
+        std::cout << "Slice clamping error\n";
+        success = false;
+    }
+    if (!q.slice(500, 500).empty() || !q.slice(-5, 0).empty()) {
+        std::cout << "Empty slice error\n";
+        success = false;
+    }
+
+    //Writes have to go through set, which keeps snapshots, the value index and fingerprints up to date
+    static_assert(std::is_same_v<std::ranges::range_reference_t<Slice<int>>, const int&>);
+    static_assert(!std::ranges::output_range<Slice<int>, int>);
+
+    if (success)
+        std::cout << "QuickList slice test successful.\n";
+    else
+        std::cout << "QuickList slice test failed.\n";
+    return success;
+}
+
+bool testCompaction() {
+    QuickList<int> q = makeQuickList(20000);
+    std::vector<int> reference(20000);
+    bool success = true;
+    std::cout << "\nTesting QuickList compaction...\n";
+
+    for (int i = 0; i < 20000; ++i)
+        reference[i] = i;
+    for (int i = 0; i < 5000; ++i) {
+        int index = random() % (int) reference.size();
+        q.remove(index);
+        reference.erase(reference.begin() + index);
+        index = random() % (int) reference.size();
+        q.add(index, -i);
+        reference.insert(reference.begin() + index, -i);
+    }
+
+    q.compact();
+    Node<int>* node = q.getFirstNode();
+    for (int i = 0; success && i < (int) reference.size(); ++i) {
+        if (node->getData() != reference[i] || (i > 0 && node != q.getFirstNode() + i)) {
+            std::cout << "Compaction error at index " << i << "\n";
+            success = false;
+        }
+        node = node->getNextNode();
+    }
+    if (!jumpListConsistent(q) || q.get(12345) != reference[12345]) {
+        std::cout << "JumpList inconsistent after compaction\n";
+        success = false;
+    }
+
+    q.append(1);
+    q.add(100, 2);
+    q.remove(50);
+    if (q.getLast() != 1 || q.get(99) != 2 || q.getSize() != (int) reference.size() + 1) {
+        std::cout << "Modification after compaction error\n";
+        success = false;
+    }
+
+    if (success)
+        std::cout << "QuickList compaction test successful.\n";
+    else
+        std::cout << "QuickList compaction test failed.\n";
+    return success;
+}
+
+bool testSnapshots() {
+    auto* q = new QuickList<int>(makeQuickList(30000));
+    bool success = true;
+    std::cout << "\nTesting QuickList snapshots...\n";
+
+    QuickListSnapshot<int> snapshot = q->snapshot();
+    std::atomic<bool> writing = true;
+    std::atomic<int> readerErrors = 0;
+
+    std::thread reader([&]() {
+        do {
+            int expected = 0;
+            snapshot.forEach([&](int x) {
+                if (x != expected++)
+                    readerErrors++;
+            });
+            if (expected != 30000)
+                readerErrors++;
+            int index = random() % 30000;
+            if (snapshot.get(index) != index)
+                readerErrors++;
+        } while (writing);
+    });
+
+    std::vector<int> reference(30000);
+    for (int i = 0; i < 30000; ++i)
+        reference[i] = i;
+    for (int i = 0; i < 20000; ++i) {
+        int operation = random() % 6;
+        int index = random() % (int) reference.size();
+        if (operation == 0) {
+            q->set(index, -i);
+            reference[index] = -i;
+        } else if (operation == 1) {
+            q->remove(index);
+            reference.erase(reference.begin() + index);
+        } else if (operation == 2) {
+            q->add(index, -i);
+            reference.insert(reference.begin() + index, -i);
+        } else if (operation == 3) {
+            q->prepend(-i);
+            reference.insert(reference.begin(), -i);
+        } else if (operation == 4) {
+            q->removeLast();
+            reference.pop_back();
+        } else {
+            q->removeFirst();
+            reference.erase(reference.begin());
+        }
+    }
+    writing = false;
+    reader.join();
+
+    for (int i = 0; success && i < (int) reference.size(); i += 11)
+        success = q->get(i) == reference[i];
+    if (!success || readerErrors != 0 || !jumpListConsistent(*q)) {
+        std::cout << "Snapshot changed while the QuickList was modified: " << readerErrors << " errors\n";
+        success = false;
+    }
+
+    //Unmodified snapshots share everything, the snapshot outlives its QuickList
+    QuickListSnapshot<int> unmodified = q->snapshot();
+    if (unmodified.segments->sharedCount != (int64_t) unmodified.segments->starts.size()) {
+        std::cout << "Fresh snapshot does not share its segments\n";
+        success = false;
+    }
+    delete q;
+    int64_t sum = 0;
+    unmodified.forEach([&](int x) { sum += x; });
+    int64_t expectedSum = 0;
+    for (int x : reference)
+        expectedSum += x;
+    if (sum != expectedSum || unmodified.get(100) != reference[100] || snapshot.get(29999) != 29999) {
+        std::cout << "Snapshot invalid after its QuickList has been destroyed\n";
+        success = false;
+    }
+
+    //A few writes of every kind, including rotations and spliced lists, only copy the segments they touch
+    QuickList<int> few = makeQuickList(30000);
+    QuickListSnapshot<int> original = few.snapshot();
+    for (int i = 0; success && i < 60; ++i) {
+        int index = random() % (int) few.getSize();
+        int operation = i % 7;
+        if (operation == 0)
+            few.set(index, -i);
+        else if (operation == 1)
+            few.add(index, -i);
+        else if (operation == 2)
+            few.remove(index);
+        else if (operation == 3)
+            few.rotate(index);
+        else if (operation == 4)
+            few.insertList(index, makeQuickList(100));
+        else if (operation == 5)
+            few.removeFirst();
+        else
+            few.prepend(-i);
+        int expected = 0;
+        original.forEach([&](int x) { success &= x == expected++; });
+        success &= expected == 30000;
+    }
+    if (!success || original.segments->sharedCount == 0 || few.snapshots.size() != 1) {
+        std::cout << "Snapshot invalid or copied entirely after a few writes\n";
+        success = false;
+    }
+    for (int i = 0; i < few.getSize(); ++i)
+        few.set(i, i);
+    if (original.segments->sharedCount != 0 || !few.snapshots.empty() || original.get(12345) != 12345) {
+        std::cout << "Fully copied snapshot is still tracked by its QuickList\n";
+        success = false;
+    }
+
+    if (success)
+        std::cout << "QuickList snapshot test successful.\n";
+    else
+        std::cout << "QuickList snapshot test failed.\n";
+    return success;
+}
+
+bool testSmallQuickList() {
+    SmallQuickList<int, 8> q;
+    std::vector<int> reference;
+    bool success = true;
+    std::cout << "\nTesting SmallQuickList...\n";
+
+    for (int i = 0; success && i < 100000; ++i) {
+        int operation = random() % 8;
+        int index = reference.empty() ? 0 : random() % (int) reference.size();
+        //Let the size drift between empty and a few hundred elements
+        bool growing = (i / 5000) % 2 == 0;
+        if (operation < (growing ? 4 : 1)) {
+            q.add(index, i);
+            reference.insert(reference.begin() + index, i);
+        } else if (operation == 4) {
+            q.append(i);
+            reference.push_back(i);
+        } else if (operation == 5 && !reference.empty()) {
+            q.set(index, -i);
+            reference[index] = -i;
+        } else if (!reference.empty() && operation < 7) {
+            q.remove(index);
+            reference.erase(reference.begin() + index);
+        } else if (!reference.empty() && q.get(index) != reference[index]) {
+            std::cout << "SmallQuickList error at index " << index << " after " << i << " operations\n";
+            success = false;
+        }
+
+        if (q.getSize() != (int) reference.size() || (reference.size() <= 4 && !q.isInline())) {
+            std::cout << "SmallQuickList size or representation error after " << i << " operations\n";
+            success = false;
+        }
+    }
+
+    SmallQuickList<std::string, 4> strings;
+    for (int i = 0; i < 6; ++i)
+        strings.prepend(std::to_string(i));
+    SmallQuickList<std::string, 4> copy(strings);
+    for (int i = 0; i < 4; ++i)
+        strings.removeLast();
+    if (!strings.isInline() || strings.getSize() != 2 || strings.getFirst() != "5" || strings.getLast() != "4" ||
+    copy.isInline() || copy.getSize() != 6 || copy.getLast() != "0") {
+        std::cout << "SmallQuickList copy or shrink error\n";
+        success = false;
+    }
+
+    if (success)
+        std::cout << "SmallQuickList test successful.\n";
+    else
+        std::cout << "SmallQuickList test failed.\n";
+    return success;
+}
+
+/**
+ * Forwards to the default resource and counts the bytes that pass through it
+ */
+class CountingResource : public std::pmr::memory_resource {
+public:
+    int64_t allocated = 0;
+    int64_t deallocated = 0;
+
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        allocated += (int64_t) bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        deallocated += (int64_t) bytes;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+bool testAllocators() {
+    CountingResource counting;
+    CountingResource other;
+    bool success = true;
+    std::cout << "\nTesting allocator-aware QuickList...\n";
+
+    {
+        PmrQuickList<int> q(&counting);
+        std::vector<int> reference;
+        for (int i = 0; i < 50000; ++i) {
+            q.append(i);
+            reference.push_back(i);
+        }
+        for (int i = 0; i < 5000; ++i) {
+            int index = random() % (int) reference.size();
+            q.remove(index);
+            reference.erase(reference.begin() + index);
+            index = random() % (int) reference.size();
+            q.add(index, -i);
+            reference.insert(reference.begin() + index, -i);
+        }
+        q.compact();
+
+        PmrQuickList<int> moved(&other);
+        moved = std::move(q);
+        for (int i = 0; success && i < (int) reference.size(); i += 13)
+            success = moved.get(i) == reference[i];
+        if (!success || !q.isEmpty() || !jumpListConsistent(moved) || counting.allocated == 0 || other.allocated == 0) {
+            std::cout << "QuickList with a memory resource error\n";
+            success = false;
+        }
+    }
+    if (counting.allocated != counting.deallocated || other.allocated != other.deallocated) {
+        std::cout << "Memory resource leak: " << counting.allocated - counting.deallocated << " bytes\n";
+        success = false;
+    }
+
+    //A monotonic arena without upstream fails loudly if anything bypasses it
+    std::vector<char> buffer(16 << 20);
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+    auto* q = new PmrQuickList<int>(&arena);
+    for (int i = 0; i < 200000; ++i)
+        q->append(i);
+    if (q->get(123456) != 123456 || !jumpListConsistent(*q)) {
+        std::cout << "QuickList in a monotonic arena error\n";
+        success = false;
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    delete q;
+    auto t2 = std::chrono::high_resolution_clock::now();
+    std::cout << "\t" << duration_cast<std::chrono::microseconds>(t2 - t1).count()
+    << "µs to destroy 200.000 nodes in a monotonic arena\n";
+
+    if (success)
+        std::cout << "Allocator-aware QuickList test successful.\n";
+    else
+        std::cout << "Allocator-aware QuickList test failed.\n";
+    return success;
+}
+
+bool testValueIndex() {
+    QuickList<int> q;
+    std::vector<int> reference;
+    bool success = true;
+    std::cout << "\nTesting QuickList value index...\n";
+
+    //Every 4th value is 0, too many occurrences to locate them one by one, which falls back to scanning
+    for (int i = 0; i < 3000; ++i) {
+        q.append(i % 4 == 0 ? 0 : i % 200);
+        reference.push_back(i % 4 == 0 ? 0 : i % 200);
+    }
+    q.enableValueIndex();
+
+    for (int i = 0; success && i < 10000; ++i) {
+        int operation = random() % 10;
+        int index = random() % (int) reference.size();
+        int value = random() % 4 == 0 ? 0 : (int) (random() % 200);
+        auto first = std::find(reference.begin(), reference.end(), value);
+        auto last = std::find(reference.rbegin(), reference.rend(), value);
+        int firstIndex = first == reference.end() ? -1 : (int) (first - reference.begin());
+        int lastIndex = last == reference.rend() ? -1 : (int) (reference.rend() - last) - 1;
+
+        if (operation == 0) {
+            q.set(index, value);
+            reference[index] = value;
+        } else if (operation == 1) {
+            q.add(index, value);
+            reference.insert(reference.begin() + index, value);
+        } else if (operation == 2) {
+            q.prepend(value);
+            reference.insert(reference.begin(), value);
+        } else if (operation == 3) {
+            q.append(value);
+            reference.push_back(value);
+        } else if (operation == 4) {
+            q.remove(index);
+            reference.erase(reference.begin() + index);
+        } else if (operation == 5) {
+            q.removeFirstOccurrence(value);
+            if (firstIndex != -1)
+                reference.erase(reference.begin() + firstIndex);
+        } else if (operation == 6) {
+            q.removeLastOccurrence(value);
+            if (lastIndex != -1)
+                reference.erase(reference.begin() + lastIndex);
+        } else if (operation == 7) {
+            int count = (int) std::count(reference.begin(), reference.end(), value);
+            bool removed = q.removeNthOccurrenceFromFront(value, 2);
+            if (removed != (count >= 2)) {
+                std::cout << "removeNthOccurrenceFromFront error\n";
+                success = false;
+            }
+            if (count >= 2)
+                reference.erase(std::find(first + 1, reference.end(), value));
+        } else if (operation == 8 && i % 50 == 0) {
+            q.removeAllOccurrences(value);
+            std::erase(reference, value);
+        } else if (q.indexOf(value) != firstIndex || q.lastIndexOf(value) != lastIndex) {
+            std::cout << "indexOf error for value " << value << ": " << q.indexOf(value) << " instead of " << firstIndex << "\n";
+            success = false;
+        }
+
+        if (i % 997 == 0 && (!jumpListConsistent(q) || q.getSize() != (int) reference.size())) {
+            std::cout << "JumpList inconsistent after " << i << " operations\n";
+            success = false;
+        }
+    }
+    for (int i = 0; success && i < (int) reference.size(); ++i)
+        success = q.get(i) == reference[i];
+    if (!success)
+        std::cout << "QuickList with value index differs from reference\n";
+
+    q.compact();
+    int middle = reference[reference.size() / 2];
+    if (q.indexOf(middle) != (int) (std::find(reference.begin(), reference.end(), middle) - reference.begin())) {
+        std::cout << "Value index invalid after compaction\n";
+        success = false;
+    }
+
+    if (success)
+        std::cout << "QuickList value index test successful.\n";
+    else
+        std::cout << "QuickList value index test failed.\n";
+    return success;
+}
+
+bool testRemoveIf() {
+    bool success = true;
+    std::cout << "\nTesting QuickList removeIf...\n";
+
+    for (int threads : {1, 4}) {
+        QuickList<int> q;
+        std::vector<int> reference;
+        for (int i = 0; i < 100000; ++i) {
+            int value = (int) (random() % 1000);
+            q.append(value);
+            reference.push_back(value);
+        }
+        q.get(5000);
+
+        int removed = q.removeIf([](int x) { return x % 3 == 0; }, threads);
+        int expected = (int) std::erase_if(reference, [](int x) { return x % 3 == 0; });
+        bool equal = removed == expected && q.getSize() == (int) reference.size();
+        for (int i = 0; equal && i < (int) reference.size(); i += 7)
+            equal = q.get(i) == reference[i];
+        if (!equal || !jumpListConsistent(q) || !trailingPointerConsistent(q)) {
+            std::cout << "removeIf error with " << threads << " thread(s): removed " << removed << " of " << expected << "\n";
+            success = false;
+        }
+
+        if (q.removeIf([](int) { return false; }, threads) != 0 ||
+        q.removeIf([](int) { return true; }, threads) != (int) reference.size() || !q.isEmpty()) {
+            std::cout << "removeIf of none or all nodes error\n";
+            success = false;
+        }
+    }
+
+    QuickList<int> q = makeQuickList(1000);
+    for (int i = 0; i < 1000; i += 3)
+        q.set(i, -1);
+    q.removeAllOccurrences(-1);
+    if (q.getSize() != 666 || q.indexOf(-1) != -1 || q.get(0) != 1 || !jumpListConsistent(q)) {
+        std::cout << "removeAllOccurrences error\n";
+        success = false;
+    }
+
+    if (success)
+        std::cout << "QuickList removeIf test successful.\n";
+    else
+        std::cout << "QuickList removeIf test failed.\n";
+    return success;
+}
+
+bool testLargeIndices() {
+    QuickList<int> q;
+    CompactQuickList<int> compact;
+    bool success = true;
+    std::cout << "\nTesting 64-bit sizes and indices...\n";
+
+    const int64_t boundary = (int64_t) 1 << 31;
+    for (int64_t size : {boundary - 1, boundary, boundary + 1, boundary * 3, (int64_t) 1 << 40, (int64_t) 1 << 61}) {
+        q.distance = q.calcDistance(size);
+        if (q.distance % 10 != 0 || q.lowerCritical() >= size || q.upperCritical() <= size ||
+        compact.calcDistance(size) != q.distance) {
+            std::cout << "Critical size error for size " << size << ": distance " << q.distance << "\n";
+            success = false;
+        }
+    }
+    for (int64_t n : {boundary * boundary - 1, boundary * boundary, (int64_t) 3037000499 * 3037000499}) {
+        int64_t root = QuickList<int>::integerSqrt(n);
+        if (root > n / root || root + 1 <= n / (root + 1)) {
+            std::cout << "integerSqrt error for " << n << "\n";
+            success = false;
+        }
+    }
+
+    //Grid positions past 2^31 on a list that pretends to be that large
+    q.distance = q.calcDistance(boundary * 3);
+    q.origin = 7;
+    int64_t index = boundary + 12345;
+    int64_t ordinal = q.getJumpOrdinal(index);
+    int64_t jumpIndex = (ordinal + 1) * q.distance - 1 - q.origin;
+    if (jumpIndex < boundary - q.distance || jumpIndex > index || jumpIndex + q.distance <= index ||
+    !q.indexHasJumpPointer(jumpIndex) || q.indexHasJumpPointer(jumpIndex + 1)) {
+        std::cout << "JumpPointer grid error past 2^31\n";
+        success = false;
+    }
+    q.distance = 10;
+    q.origin = 0;
+
+    if (success)
+        std::cout << "64-bit sizes and indices test successful.\n";
+    else
+        std::cout << "64-bit sizes and indices test failed.\n";
+    return success;
+}
+
+bool testFingers() {
+    QuickList<int> q;
+    std::vector<int> reference;
+    bool success = true;
+    std::cout << "\nTesting QuickList fingers...\n";
+
+    for (int i = 0; i < 200000; ++i) {
+        q.append(i);
+        reference.push_back(i);
+    }
+
+    //Three interleaved sequential streams, two forward and one backward
+    int64_t cursors[3] = {10000, 90000, 190000};
+    q.resetFingerStatistics();
+    for (int i = 0; success && i < 30000; ++i) {
+        int64_t index = cursors[i % 3];
+        cursors[i % 3] += i % 3 == 2 ? -1 : 1;
+        if (q.search(index).node->getData() != index) {
+            std::cout << "Search error for stream " << i % 3 << " at index " << index << "\n";
+            success = false;
+        }
+    }
+    if (q.fingerHitRate() < 0.99) {
+        std::cout << "Finger hit rate of interleaved streams only " << q.fingerHitRate() << "\n";
+        success = false;
+    }
+
+    //Interleaved streams that insert and remove behind each other
+    for (int i = 0; success && i < 20000; ++i) {
+        int stream = (int) (random() % 3);
+        int64_t index = std::clamp<int64_t>(cursors[stream], 1, (int64_t) reference.size() - 2);
+        int operation = (int) (random() % 4);
+        if (operation == 0) {
+            q.add(index, -i);
+            reference.insert(reference.begin() + index, -i);
+        } else if (operation == 1) {
+            q.remove(index);
+            reference.erase(reference.begin() + index);
+        } else if (q.get(index) != reference[index]) {
+            std::cout << "Get error at index " << index << "\n";
+            success = false;
+        }
+        cursors[stream] = index + (stream == 2 ? -1 : 1);
+
+        if (i % 499 == 0 && (!jumpListConsistent(q) || !trailingPointerConsistent(q))) {
+            std::cout << "JumpList or fingers inconsistent after " << i << " operations\n";
+            success = false;
+        }
+    }
+    for (int i = 0; success && i < (int) reference.size(); i += 97)
+        success = q.get(i) == reference[i];
+
+    if (success)
+        std::cout << "QuickList fingers test successful.\n";
+    else
+        std::cout << "QuickList fingers test failed.\n";
+    return success;
+}
+
+bool testMutationAwareFingers() {
+    QuickList<int> q;
+    std::vector<int> reference;
+    bool success = true;
+    std::cout << "\nTesting fingers across inserts and removals...\n";
+
+    for (int i = 0; i < 100000; ++i) {
+        q.append(i);
+        reference.push_back(i);
+    }
+
+    //Typing, cursor moves and backspacing in the middle should not need any JumpList search
+    int64_t cursor = 50000;
+    int operations = 0;
+    q.get(cursor);
+    q.resetFingerStatistics();
+    for (int i = 0; success && i < 5000; ++i, ++operations) {
+        q.add(cursor, -i);
+        reference.insert(reference.begin() + cursor, -i);
+        cursor++;
+        if (i % 7 == 0) {
+            success = q.get(cursor) == reference[cursor];
+            cursor++;
+            operations++;
+        }
+    }
+    for (int i = 0; i < 3000; ++i, ++operations) {
+        cursor--;
+        q.remove(cursor);
+        reference.erase(reference.begin() + cursor);
+    }
+    double stepsPerOperation = (double) q.searchSteps / operations;
+    if (stepsPerOperation > 3) {
+        std::cout << "Editing needed " << stepsPerOperation << " search steps per operation\n";
+        success = false;
+    }
+    for (int i = 0; success && i < (int) reference.size(); i += 13)
+        success = q.get(i) == reference[i];
+
+    //Every mutating operation has to keep all fingers on their nodes
+    q.clear();
+    reference.clear();
+    for (int i = 0; i < 3000; ++i) {
+        q.append(i);
+        reference.push_back(i);
+    }
+    for (int i = 0; success && i < 20000; ++i) {
+        int operation = (int) (random() % 9);
+        int64_t index = random() % (int64_t) reference.size();
+        if (operation == 0) {
+            q.add(index, -i);
+            reference.insert(reference.begin() + index, -i);
+        } else if (operation == 1) {
+            q.remove(index);
+            reference.erase(reference.begin() + index);
+        } else if (operation == 2) {
+            q.prepend(-i);
+            reference.insert(reference.begin(), -i);
+        } else if (operation == 3) {
+            q.removeFirst();
+            reference.erase(reference.begin());
+        } else if (operation == 4) {
+            q.append(-i);
+            reference.push_back(-i);
+        } else if (operation == 5) {
+            q.removeLast();
+            reference.pop_back();
+        } else if (operation == 6 && i % 100 == 0) {
+            int64_t end = std::min<int64_t>(index + 20, (int64_t) reference.size() - 1);
+            q.removeRange(index, end);
+            reference.erase(reference.begin() + index, reference.begin() + end + 1);
+        } else if (q.get(index) != reference[index]) {
+            std::cout << "Get error at index " << index << "\n";
+            success = false;
+        }
+        if (reference.size() < 100) {
+            q.append(-i);
+            reference.push_back(-i);
+        }
+
+        if (!trailingPointerConsistent(q)) {
+            std::cout << "Fingers inconsistent after operation " << operation << " in step " << i << "\n";
+            success = false;
+        }
+    }
+    if (!jumpListConsistent(q) || q.getSize() != (int64_t) reference.size())
+        success = false;
+
+    if (success)
+        std::cout << "Fingers across inserts and removals test successful.\n";
+    else
+        std::cout << "Fingers across inserts and removals test failed.\n";
+    return success;
+}
+
+bool testInsertRange() {
+    QuickList<int> q;
+    std::vector<int> reference;
+    bool success = true;
+    std::cout << "\nTesting QuickList insertRange and insertList...\n";
+
+    for (int i = 0; i < 500; ++i) {
+        q.append(i);
+        reference.push_back(i);
+    }
+
+    for (int i = 0; success && i < 3000; ++i) {
+        int64_t index = random() % ((int64_t) reference.size() + 20) - 10;
+        int64_t count = i % 10 == 0 ? random() % 400 : random() % 40;
+        std::vector<int> block;
+        for (int64_t k = 0; k < count; ++k)
+            block.push_back(i * 1000 + (int) k);
+        if (i % 600 == 599) {
+            q.prepend(-1);
+            reference.insert(reference.begin(), -1);
+        }
+        int64_t position = std::clamp<int64_t>(index, 0, (int64_t) reference.size());
+        reference.insert(reference.begin() + position, block.begin(), block.end());
+
+        Node<int>* first;
+        if (i % 3 == 0) {
+            QuickList<int> other;
+            for (int x : block)
+                other.append(x);
+            first = q.insertList(index, std::move(other));
+            if (!other.isEmpty())
+                success = false;
+        } else {
+            first = q.insertRange(index, block.begin(), block.end());
+        }
+
+        if ((count == 0) != (first == nullptr) || (first != nullptr && q.indexOf(first) != position)) {
+            std::cout << "Wrong first node after inserting " << count << " elements at " << index << "\n";
+            success = false;
+        }
+        if (!jumpListConsistent(q) || !trailingPointerConsistent(q) || q.getSize() != (int64_t) reference.size()) {
+            std::cout << "JumpList inconsistent after inserting " << count << " elements at " << index << "\n";
+            success = false;
+        }
+        if (i % 50 == 0 && reference.size() > 20000) {
+            q.removeRange(0, (int64_t) reference.size() - 1001);
+            reference.erase(reference.begin(), reference.end() - 1000);
+        }
+    }
+    for (int i = 0; success && i < (int) reference.size(); ++i)
+        success = q.get(i) == reference[i];
+
+    if (success)
+        std::cout << "QuickList insertRange and insertList test successful.\n";
+    else
+        std::cout << "QuickList insertRange and insertList test failed.\n";
+    return success;
+}
+
+/**
+ * Compares a QuickList with a reference in the order of the QuickList and, walking backwards over the nodes,
+ * in physical order
+ */
+bool sameElements(QuickList<int>& q, std::deque<int>& reference) {
+    if (q.getSize() != (int64_t) reference.size())
+        return false;
+    int64_t index = 0;
+    for (int x : q.slice(0, q.getSize()))
+        if (x != reference[index++])
+            return false;
+
+    Node<int>* node = q.getLastNode();
+    for (int64_t i = q.getMaxIndex(); i >= 0; i--, node = node->getPrevNode())
+        if (node->getData() != reference[q.isReversed() ? q.getMaxIndex() - i : i])
+            return false;
+    return node == q.getHead();
+}
+
+bool testRotateReverse() {
+    QuickList<int> q;
+    std::deque<int> reference;
+    bool success = true;
+    std::cout << "\nTesting QuickList rotate and reverse...\n";
+
+    for (int i = 0; i < 2000; ++i) {
+        q.append(i);
+        reference.push_back(i);
+    }
+
+    for (int i = 0; success && i < 6000; ++i) {
+        if (i == 3000)
+            q.enableValueIndex();
+        int operation = (int) (random() % 12);
+        auto size = (int64_t) reference.size();
+        int64_t index = random() % size;
+
+        if (operation == 0) {
+            int64_t k = random() % (3 * size) - size;
+            q.rotate(k);
+            std::rotate(reference.begin(), reference.begin() + (k % size + size) % size, reference.end());
+        } else if (operation == 1 && i % 4 == 0) {
+            q.reverse();
+            std::reverse(reference.begin(), reference.end());
+        } else if (operation == 2) {
+            q.add(index, -i);
+            reference.insert(reference.begin() + index, -i);
+        } else if (operation == 3) {
+            q.remove(index);
+            reference.erase(reference.begin() + index);
+        } else if (operation == 4) {
+            q.prepend(-i);
+            reference.push_front(-i);
+        } else if (operation == 5) {
+            q.append(-i);
+            reference.push_back(-i);
+        } else if (operation == 6) {
+            q.removeFirst();
+            reference.pop_front();
+        } else if (operation == 7) {
+            q.removeLast();
+            reference.pop_back();
+        } else if (operation == 8) {
+            std::vector<int> block(random() % 30, -i);
+            for (size_t k = 0; k < block.size(); ++k)
+                block[k] -= (int) k;
+            q.insertRange(index, block.begin(), block.end());
+            reference.insert(reference.begin() + index, block.begin(), block.end());
+        } else if (operation == 9) {
+            Node<int>* handle = q.add(index, -i);
+            reference.insert(reference.begin() + index, -i);
+            q.insertBefore(handle, -i - 1);
+            reference.insert(reference.begin() + index, -i - 1);
+            if (q.indexOf(handle) != index + 1) {
+                std::cout << "indexOf(handle) error\n";
+                success = false;
+            }
+            Node<int>* next = q.eraseAt(handle);
+            reference.erase(reference.begin() + index + 1);
+            if (index + 1 < (int64_t) reference.size() ? next->getData() != reference[index + 1] : next != q.getTail()) {
+                std::cout << "eraseAt returned the wrong node\n";
+                success = false;
+            }
+        } else if (operation == 10 && i % 10 == 0) {
+            int64_t end = std::min<int64_t>(index + 15, size - 1);
+            q.removeRange(index, end);
+            reference.erase(reference.begin() + index, reference.begin() + end + 1);
+        } else {
+            int value = reference[index];
+            auto first = std::find(reference.begin(), reference.end(), value) - reference.begin();
+            auto last = reference.rend() - std::find(reference.rbegin(), reference.rend(), value) - 1;
+            if (q.get(index) != value || q.indexOf(value) != first || q.lastIndexOf(value) != last ||
+            q.getFirst() != reference.front() || q.getLast() != reference.back()) {
+                std::cout << "Read error at index " << index << "\n";
+                success = false;
+            }
+        }
+        while (reference.size() < 50) {
+            q.append(-i);
+            reference.push_back(-i);
+        }
+
+        if (i % 97 == 0 && (!jumpListConsistent(q) || !trailingPointerConsistent(q) || !sameElements(q, reference))) {
+            std::cout << "QuickList differs from reference after operation " << operation << " in step " << i << "\n";
+            success = false;
+        }
+    }
+    if (!q.isReversed()) {
+        q.reverse();
+        std::reverse(reference.begin(), reference.end());
+    }
+    success = success && jumpListConsistent(q) && sameElements(q, reference);
+
+    //Snapshots, copies and saved lists keep the reversed order
+    QuickListSnapshot<int> view = q.snapshot();
+    QuickList<int> copy(q);
+    std::stringstream stream;
+    q.saveTo(stream);
+    QuickList<int> loaded;
+    loaded.loadFrom(stream);
+    q.removeFirstOccurrence(reference.front());
+    q.rotate(7);
+
+    int64_t index = 0;
+    view.forEach([&](int x) {
+        if (x != reference[index++])
+            success = false;
+    });
+    if (view.get(3) != reference[3] || !sameElements(copy, reference) || !sameElements(loaded, reference)) {
+        std::cout << "Snapshot, copy or saved QuickList not in reversed order\n";
+        success = false;
+    }
+
+    if (success)
+        std::cout << "QuickList rotate and reverse test successful.\n";
+    else
+        std::cout << "QuickList rotate and reverse test failed.\n";
+    return success;
+}
+
+bool testBulkCopy() {
+    bool success = true;
+    std::cout << "\nTesting QuickList bulk copies...\n";
+
+    std::vector<int> reference;
+    for (int i = 0; i < 200000; ++i)
+        reference.push_back((int) (random() % 100000));
+
+    QuickList<int> q;
+    q.assign(reference);
+    if (q.getSize() != (int64_t) reference.size() || !jumpListConsistent(q) || q.toVector() != reference) {
+        std::cout << "assign or toVector error\n";
+        success = false;
+    }
+
+    for (int threads : {1, 3, 8}) {
+        std::vector<int> copy = q.toVector(threads);
+        if (copy != reference) {
+            std::cout << "toVector error with " << threads << " thread(s)\n";
+            success = false;
+        }
+
+        for (int i = 0; i < 50; ++i) {
+            int64_t start = random() % (int64_t) reference.size();
+            int64_t end = start + random() % 20000;
+            std::vector<int> range(20000, -1);
+            int64_t copied = q.copyRange(start, end, range.data(), threads);
+            int64_t expected = std::min<int64_t>(end, (int64_t) reference.size()) - start;
+            if (copied != expected || !std::equal(range.begin(), range.begin() + copied, reference.begin() + start) ||
+            (copied < (int64_t) range.size() && range[copied] != -1)) {
+                std::cout << "copyRange error for [" << start << ", " << end << ") with " << threads << " thread(s)\n";
+                success = false;
+                break;
+            }
+        }
+    }
+
+    std::vector<int> prefix(1000);
+    if (q.copyTo(prefix) != 1000 || !std::equal(prefix.begin(), prefix.end(), reference.begin()) ||
+    q.copyRange(-5, 3, prefix.data()) != 3 || q.copyRange(10, 10, prefix.data()) != 0) {
+        std::cout << "copyTo or clamping error\n";
+        success = false;
+    }
+
+    q.reverse();
+    std::vector<int> reversedReference(reference.rbegin(), reference.rend());
+    std::vector<int> range(5000);
+    if (q.toVector(4) != reversedReference || q.copyRange(777, 5777, range.data(), 4) != 5000 ||
+    !std::equal(range.begin(), range.end(), reversedReference.begin() + 777)) {
+        std::cout << "reversed copy error\n";
+        success = false;
+    }
+
+    std::vector<int> small {3, 1, 4, 1, 5};
+    q.assign(small);
+    if (q.isReversed() || q.toVector() != small || !jumpListConsistent(q) || !trailingPointerConsistent(q)) {
+        std::cout << "assign over a reversed QuickList error\n";
+        success = false;
+    }
+    q.assign(std::span<const int>());
+    if (!q.isEmpty() || !q.toVector().empty()) {
+        std::cout << "empty assign error\n";
+        success = false;
+    }
+
+    if (success)
+        std::cout << "QuickList bulk copy test successful.\n";
+    else
+        std::cout << "QuickList bulk copy test failed.\n";
+    return success;
+}
+
+bool testMemoryUsage() {
+    bool success = true;
+    std::cout << "\nTesting QuickList memory usage and shrinkToFit...\n";
+
+    QuickList<int64_t> q;
+    for (int i = 0; i < 100000; ++i)
+        q.append(i);
+    QuickList<int64_t>::MemoryUsage usage = q.memoryUsage();
+    size_t nodeSize = sizeof(Node<int64_t>);
+    if (usage.dataNodeBytes < 100002 * nodeSize || usage.dataNodeBytes > 100002 * nodeSize + 4096 ||
+    usage.jumpIndexBytes < (size_t) q.jumpList.getSize() * sizeof(Node<Node<int64_t>*>) ||
+    usage.valueIndexBytes != 0 || usage.total() <= usage.dataNodeBytes + usage.jumpIndexBytes) {
+        std::cout << "memoryUsage breakdown error: " << usage.dataNodeBytes << " data, " << usage.jumpIndexBytes << " jump\n";
+        success = false;
+    }
+
+    for (int i = 0; i < 90000; ++i)
+        q.remove(random() % q.getSize());
+    usage = q.memoryUsage();
+    if (usage.pooledFreeBytes < 90000 * nodeSize) {
+        std::cout << "pooled free bytes error: " << usage.pooledFreeBytes << "\n";
+        success = false;
+    }
+
+    std::vector<int64_t> before = q.toVector();
+    size_t released = q.shrinkToFit();
+    QuickList<int64_t>::MemoryUsage shrunk = q.memoryUsage();
+    if (released < 90000 * nodeSize || shrunk.pooledFreeBytes != 0 || shrunk.total() + released != usage.total() ||
+    q.toVector() != before || !jumpListConsistent(q) || !trailingPointerConsistent(q)) {
+        std::cout << "shrinkToFit error: released " << released << ", " << shrunk.pooledFreeBytes << " still free\n";
+        success = false;
+    }
+    if (q.shrinkToFit() != 0) {
+        std::cout << "repeated shrinkToFit error\n";
+        success = false;
+    }
+
+    q.enableValueIndex();
+    q.removeRange(0, 4999);
+    usage = q.memoryUsage();
+    q.shrinkToFit();
+    if (usage.valueIndexBytes == 0 || q.memoryUsage().total() >= usage.total() || q.indexOf(before[7000]) != 2000) {
+        std::cout << "shrinkToFit with value index error\n";
+        success = false;
+    }
+
+    q.clear();
+    usage = q.memoryUsage();
+    if (usage.dataNodeBytes < 2 * nodeSize || usage.dataNodeBytes > 2 * nodeSize + 4096 || usage.pooledFreeBytes != 0) {
+        std::cout << "memoryUsage of an empty QuickList error\n";
+        success = false;
+    }
+
+    if (success)
+        std::cout << "QuickList memory usage test successful.\n";
+    else
+        std::cout << "QuickList memory usage test failed.\n";
+    return success;
+}
+
+bool fingerprintsConsistent(QuickList<int>& q) {
+    std::deque<uint64_t> maintained = q.fingerprints;
+    q.rehashFingerprints();
+    return maintained == q.fingerprints;
+}
+
+bool testFingerprints() {
+    bool success = true;
+    std::cout << "\nTesting QuickList fingerprints...\n";
+
+    QuickList<int> q;
+    q.enableFingerprints();
+    std::deque<int> reference;
+    for (int i = 0; i < 3000; ++i) {
+        q.append(i);
+        reference.push_back(i);
+    }
+
+    for (int i = 0; i < 6000 && success; ++i) {
+        int64_t index = random() % (int64_t) (reference.size() + 1);
+        int value = (int) (random() % 100);
+        int operation = (int) (random() % 13);
+        if (reference.empty() && operation >= 4)
+            operation = 0;
+        switch (operation) {
+            case 0: case 1:
+                q.add(index, value);
+                reference.insert(reference.begin() + index, value);
+                break;
+            case 2:
+                q.append(value);
+                reference.push_back(value);
+                break;
+            case 3:
+                q.prepend(value);
+                reference.push_front(value);
+                break;
+            case 4: case 5:
+                index %= (int64_t) reference.size();
+                q.remove(index);
+                reference.erase(reference.begin() + index);
+                break;
+            case 6:
+                q.removeFirst();
+                reference.pop_front();
+                break;
+            case 7:
+                q.removeLast();
+                reference.pop_back();
+                break;
+            case 8: case 9:
+                index %= (int64_t) reference.size();
+                q.set(index, value);
+                reference[index] = value;
+                break;
+            case 10: {
+                int64_t k = random() % (int64_t) reference.size();
+                q.rotate(k);
+                std::rotate(reference.begin(), reference.begin() + k, reference.end());
+                break;
+            }
+            case 11: {
+                std::vector<int> block(random() % 40, value);
+                q.insertRange(index, block.begin(), block.end());
+                reference.insert(reference.begin() + index, block.begin(), block.end());
+                break;
+            }
+            default: {
+                index %= (int64_t) reference.size();
+                int64_t end = std::min<int64_t>(index + random() % 20, (int64_t) reference.size() - 1);
+                q.removeRange(index, end);
+                reference.erase(reference.begin() + index, reference.begin() + end + 1);
+                break;
+            }
+        }
+        if (!fingerprintsConsistent(q) || !sameElements(q, reference)) {
+            std::cout << "Fingerprint maintenance error after operation " << operation << " in step " << i << "\n";
+            success = false;
+        }
+    }
+
+    QuickList<int> replica;
+    replica.enableFingerprints();
+    QuickList<int> plain;
+    for (int i = 0; i < 200000; ++i) {
+        int value = (int) (random() % 1000);
+        q.append(value);
+        replica.append(value);
+        plain.append(value);
+    }
+    while (q.getSize() > replica.getSize())
+        replica.prepend(q.get(q.getSize() - replica.getSize() - 1));
+    for (int64_t i = 0; i < q.getSize() - 200000; ++i)
+        plain.add(i, q.get(i));
+    replica.forceRebuildJumpList();
+    q.forceRebuildJumpList();
+
+    if (!(q == replica) || q.firstDifference(replica) != -1 || !(q == plain) || q.firstDifference(plain) != -1) {
+        std::cout << "Equality error for equal QuickLists\n";
+        success = false;
+    }
+
+    int64_t changed = q.getSize() - 12345;
+    replica.set(changed, replica.get(changed) + 1);
+    plain.set(changed, plain.get(changed) + 1);
+    if (q == replica || q.firstDifference(replica) != changed || q == plain || q.firstDifference(plain) != changed) {
+        std::cout << "firstDifference error: expected " << changed << ", got " << q.firstDifference(replica) << "\n";
+        success = false;
+    }
+
+    replica.removeLast();
+    replica.set(changed, replica.get(changed) - 1);
+    if (q.firstDifference(replica) != replica.getSize() || replica.firstDifference(q) != replica.getSize()) {
+        std::cout << "firstDifference error for a prefix\n";
+        success = false;
+    }
+
+    QuickList<int> copy(q);
+    q.reverse();
+    copy.reverse();
+    if (!copy.hasFingerprints() || !(q == copy) || q.firstDifference(copy) != -1) {
+        std::cout << "Equality error for reversed QuickLists\n";
+        success = false;
+    }
+
+    if (success)
+        std::cout << "QuickList fingerprints test successful.\n";
+    else
+        std::cout << "QuickList fingerprints test failed.\n";
+    return success;
+}
+
+bool testIndexedMap() {
+    bool success = true;
+    std::cout << "\nTesting IndexedMap...\n";
+
+    IndexedMap<std::string, int> map;
+    std::vector<std::pair<std::string, int>> reference;
+    auto referencePosition = [&reference](const std::string& key) {
+        for (int64_t i = 0; i < (int64_t) reference.size(); i++)
+            if (reference[i].first == key)
+                return i;
+        return (int64_t) -1;
+    };
+
+    for (int i = 0; i < 20000 && success; ++i) {
+        std::string key = std::to_string(random() % 3000);
+        int value = (int) (random() % 1000);
+        int64_t position = reference.empty() ? 0 : random() % (int64_t) reference.size();
+        int64_t found = referencePosition(key);
+        switch (random() % 5) {
+            case 0:
+                if (map.insert(key, value) != (found == -1)) {
+                    std::cout << "insert error for key " << key << "\n";
+                    success = false;
+                }
+                if (found == -1)
+                    reference.emplace_back(key, value);
+                break;
+            case 1:
+                if (map.insert(position, key, value) != (found == -1)) {
+                    std::cout << "positional insert error for key " << key << "\n";
+                    success = false;
+                }
+                if (found == -1)
+                    reference.emplace(reference.begin() + position, key, value);
+                break;
+            case 2:
+                if (map.erase(key) != (found != -1)) {
+                    std::cout << "erase error for key " << key << "\n";
+                    success = false;
+                }
+                if (found != -1)
+                    reference.erase(reference.begin() + found);
+                break;
+            case 3:
+                if (map.move(key, position) != (found != -1)) {
+                    std::cout << "move error for key " << key << "\n";
+                    success = false;
+                }
+                if (found != -1) {
+                    auto entry = reference[found];
+                    reference.erase(reference.begin() + found);
+                    reference.insert(reference.begin() + std::min<int64_t>(position, (int64_t) reference.size()), entry);
+                }
+                break;
+            default:
+                map.set(key, value);
+                if (found != -1)
+                    reference[found].second = value;
+                else
+                    reference.emplace_back(key, value);
+                break;
+        }
+
+        int* mapped = map.find(key);
+        int64_t expected = referencePosition(key);
+        if (map.getSize() != (int64_t) reference.size() || map.positionOf(key) != expected ||
+        (mapped == nullptr) != (expected == -1) || (mapped != nullptr && *mapped != reference[expected].second)) {
+            std::cout << "Lookup error for key " << key << " in step " << i << "\n";
+            success = false;
+        }
+        if (!reference.empty()) {
+            int64_t probe = random() % (int64_t) reference.size();
+            if (map.at(probe) != reference[probe]) {
+                std::cout << "Positional access error at " << probe << "\n";
+                success = false;
+            }
+        }
+    }
+
+    int64_t index = 0;
+    for (auto& entry : map.view())
+        if (entry != reference[index++])
+            success = false;
+    if (index != (int64_t) reference.size() || !jumpListConsistent(map.entries)) {
+        std::cout << "Iteration error\n";
+        success = false;
+    }
+
+    IndexedMap<std::string, int> copy(map);
+    IndexedMap<std::string, int> assigned;
+    assigned.insert("stale", 0);
+    assigned = copy;
+    if (reference.size() >= 2) {
+        std::string first = reference.front().first;
+        std::string last = reference.back().first;
+        copy.set(first, -1);
+        copy.erase(last);
+        copy.insert("copy", 1);
+        map.erase(first);
+        map.set(last, -2);
+        assigned.move(last, 0);
+        if (map.find(first) != nullptr || *map.find(last) != -2 || map.contains("copy") ||
+        *copy.find(first) != -1 || copy.find(last) != nullptr || copy.positionOf("copy") != copy.getSize() - 1 ||
+        assigned.contains("stale") || assigned.positionOf(last) != 0 || *assigned.find(first) != reference.front().second ||
+        !jumpListConsistent(copy.entries) || !jumpListConsistent(assigned.entries)) {
+            std::cout << "copy error\n";
+            success = false;
+        }
+    }
+    copy.clear();
+    assigned.clear();
+
+    map.clear();
+    if (!map.isEmpty() || map.find("1") != nullptr || map.positionOf("1") != -1) {
+        std::cout << "clear error\n";
+        success = false;
+    }
+
+    if (success)
+        std::cout << "IndexedMap test successful.\n";
+    else
+        std::cout << "IndexedMap test failed.\n";
+    return success;
+}
+
+bool testBackgroundRebuild() {
+    QuickList<int> q;
+    std::deque<int> reference;
+    bool success = true;
+    std::cout << "\nTesting QuickList background rebuilds...\n";
+
+    q.setBackgroundRebuild(true);
+    for (int i = 0; i < 70000; ++i) {
+        q.append(i);
+        reference.push_back(i);
+    }
+    //Mixes every operation that keeps the helper running until it has installed two new JumpLists
+    int64_t distance = q.distance;
+    int rebuilds = 0;
+    for (int i = 0; rebuilds < 2 && success; ++i) {
+        int64_t index = reference.empty() ? 0 : random() % (int64_t) reference.size();
+        switch (random() % 10) {
+            case 0:
+                q.prepend(i);
+                reference.push_front(i);
+                break;
+            case 1:
+                q.add(index, i);
+                reference.insert(reference.begin() + index, i);
+                break;
+            case 2:
+                if (!reference.empty()) {
+                    q.remove(index);
+                    reference.erase(reference.begin() + index);
+                }
+                break;
+            case 3:
+                if (!reference.empty()) {
+                    q.removeFirst();
+                    reference.pop_front();
+                }
+                break;
+            case 4:
+                if (!reference.empty()) {
+                    q.set(index, -i);
+                    reference[index] = -i;
+                }
+                break;
+            case 5:
+                if (!reference.empty() && q.get(index) != reference[index]) {
+                    std::cout << "get error at " << index << " in step " << i << "\n";
+                    success = false;
+                }
+                break;
+            case 6:
+                if (!reference.empty()) {
+                    q.removeLast();
+                    reference.pop_back();
+                }
+                break;
+            default:
+                q.append(i);
+                reference.push_back(i);
+                break;
+        }
+        if ((i % 1000 == 0 || q.distance != distance) && !jumpListConsistent(q)) {
+            std::cout << "JumpList inconsistent in step " << i << "\n";
+            success = false;
+        }
+        if (q.distance != distance) {
+            distance = q.distance;
+            rebuilds++;
+        }
+    }
+    if (!sameElements(q, reference)) {
+        std::cout << "Elements differ after the background rebuilds\n";
+        success = false;
+    }
+
+    //Operations that relink many nodes cancel the helper
+    while (!q.isRebuildingInBackground())
+        q.append(0), reference.push_back(0);
+    q.removeRange(10, 5000);
+    reference.erase(reference.begin() + 10, reference.begin() + 5001);
+    if (q.isRebuildingInBackground() || q.distance != q.calcDistance() || !jumpListConsistent(q)) {
+        std::cout << "removeRange did not cancel the background rebuild\n";
+        success = false;
+    }
+
+    //A pending rebuild moves along with the nodes
+    while (!q.isRebuildingInBackground())
+        q.append(1), reference.push_back(1);
+    QuickList<int> moved(std::move(q));
+    while (moved.isRebuildingInBackground())
+        moved.get(0);
+    if (!jumpListConsistent(moved) || moved.distance != moved.calcDistance() || !sameElements(moved, reference) ||
+    q.isRebuildingInBackground() || !q.isEmpty()) {
+        std::cout << "Move error during a background rebuild\n";
+        success = false;
+    }
+
+    if (success)
+        std::cout << "QuickList background rebuild test successful.\n";
+    else
+        std::cout << "QuickList background rebuild test failed.\n";
+    return success;
+}
+
 void runTests() {
-    int testAmount = 4;
+    int testAmount = 28;
     int successfulTests = 1;
 
     //Performance test can't be failed
@@ -263,6 +2213,30 @@ void runTests() {
     if (testQuickSearchAccuracy()) ++successfulTests;
     if (testAdd()) ++successfulTests;
     if (testPrepend()) ++successfulTests;
+    if (testTraceRecording()) ++successfulTests;
+    if (testSnapshot()) ++successfulTests;
+    if (testPersistentQuickLists()) ++successfulTests;
+    if (testCompactQuickList()) ++successfulTests;
+    if (testCopyAndMove()) ++successfulTests;
+    if (testDequeOperations()) ++successfulTests;
+    if (testHandles()) ++successfulTests;
+    if (testSlice()) ++successfulTests;
+    if (testCompaction()) ++successfulTests;
+    if (testSnapshots()) ++successfulTests;
+    if (testSmallQuickList()) ++successfulTests;
+    if (testAllocators()) ++successfulTests;
+    if (testValueIndex()) ++successfulTests;
+    if (testRemoveIf()) ++successfulTests;
+    if (testLargeIndices()) ++successfulTests;
+    if (testFingers()) ++successfulTests;
+    if (testMutationAwareFingers()) ++successfulTests;
+    if (testInsertRange()) ++successfulTests;
+    if (testRotateReverse()) ++successfulTests;
+    if (testBulkCopy()) ++successfulTests;
+    if (testMemoryUsage()) ++successfulTests;
+    if (testFingerprints()) ++successfulTests;
+    if (testIndexedMap()) ++successfulTests;
+    if (testBackgroundRebuild()) ++successfulTests;
 
     std::cout << "\n" << successfulTests << " of " << testAmount << " tests successful.\n";
 }
@@ -0,0 +1,161 @@
+#include <cstdint>
+#include <fstream>
+
+/**
+ * Records the positional operations issued against a QuickList into a compact binary trace, so that
+ * real access patterns can be replayed offline (see replay.cpp). Every operation that changes the size
+ * is recorded, bulk removals as one REMOVE per node and clearing as CLEAR, so that the indices of the
+ * following entries stay valid on replay.
+ *
+ * Trace layout: the magic bytes "QLTR", one version byte and the size of the list at the time
+ * recording started, followed by one entry per operation. An entry is a single operation byte
+ * followed by its index as a zigzag encoded varint, so most entries take 2 to 4 bytes.
+ */
+class TraceRecorder {
+public:
+    enum Operation : uint8_t {
+        GET,
+        SET,
+        ADD,
+        REMOVE,
+        APPEND,
+        PREPEND,
+        //Removes all elements, the index is unused. Added in version 2.
+        CLEAR
+    };
+
+    typedef struct TraceEntry {
+        Operation op;
+        int64_t index;
+    } TraceEntry;
+
+    static constexpr char magic[4] = {'Q', 'L', 'T', 'R'};
+    static constexpr uint8_t version = 2;
+
+    std::ofstream out;
+    int64_t entries = 0;
+
+    /**
+     * Opens the trace file and writes its header.
+     * @param path
+     * @param initialSize Size of the recorded list at the time recording starts
+     * @return True if the file could be opened
+     */
+    bool open(const char* path, int64_t initialSize) {
+        out.open(path, std::ios::binary | std::ios::trunc);
+        if (!out.is_open())
+            return false;
+
+        out.write(magic, sizeof(magic));
+        out.put((char) version);
+        writeVarint(zigzag(initialSize));
+        entries = 0;
+        return out.good();
+    }
+
+    bool isOpen() {
+        return out.is_open();
+    }
+
+    void record(Operation op, int64_t index) {
+        out.put((char) op);
+        writeVarint(zigzag(index));
+        entries++;
+    }
+
+    void close() {
+        if (out.is_open())
+            out.close();
+    }
+
+    ~TraceRecorder() {
+        close();
+    }
+
+    static uint64_t zigzag(int64_t value) {
+        return ((uint64_t) value << 1) ^ (uint64_t) (value >> 63);
+    }
+
+    static int64_t unzigzag(uint64_t value) {
+        return (int64_t) (value >> 1) ^ -(int64_t) (value & 1);
+    }
+
+    void writeVarint(uint64_t value) {
+        while (value >= 0x80) {
+            out.put((char) (value | 0x80));
+            value >>= 7;
+        }
+        out.put((char) value);
+    }
+};
+
+/**
+ * Reads a trace written by a TraceRecorder entry by entry.
+ */
+class TraceReader {
+public:
+    std::ifstream in;
+    int64_t initialSize = 0;
+
+    /**
+     * Opens the trace file and validates its header.
+     * @param path
+     * @return True if the file exists and is a trace of a supported version, which includes all older ones
+     */
+    bool open(const char* path) {
+        in.open(path, std::ios::binary);
+        if (!in.is_open())
+            return false;
+
+        char header[sizeof(TraceRecorder::magic)];
+        in.read(header, sizeof(header));
+        for (int i = 0; i < (int) sizeof(header); i++)
+            if (!in || header[i] != TraceRecorder::magic[i])
+                return false;
+
+        int traceVersion = in.get();
+        if (traceVersion < 1 || traceVersion > TraceRecorder::version)
+            return false;
+
+        uint64_t size;
+        if (!readVarint(size))
+            return false;
+        initialSize = TraceRecorder::unzigzag(size);
+        return true;
+    }
+
+    int64_t getInitialSize() {
+        return initialSize;
+    }
+
+    /**
+     * @param entry Receives the next entry
+     * @return False once the end of the trace has been reached
+     */
+    bool next(TraceRecorder::TraceEntry& entry) {
+        int op = in.get();
+        if (op == std::ifstream::traits_type::eof() || op > TraceRecorder::CLEAR)
+            return false;
+
+        uint64_t index;
+        if (!readVarint(index))
+            return false;
+
+        entry.op = (TraceRecorder::Operation) op;
+        entry.index = TraceRecorder::unzigzag(index);
+        return true;
+    }
+
+    bool readVarint(uint64_t& value) {
+        value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            int byte = in.get();
+            if (byte == std::ifstream::traits_type::eof())
+                return false;
+            value |= (uint64_t) (byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return true;
+        }
+        return false;
+    }
+};